@@ -1,5 +1,320 @@
 #include <benchmark/benchmark.h>
 
-// Add bechmarks here
+#include <uuids/binlog.hpp>
+#include <uuids/bulk.hpp>
+#include <uuids/entropy.hpp>
+#include <uuids/quality.hpp>
+#include <uuids/trace.hpp>
+#include <uuids/uuid_map.hpp>
+#include <uuids/uuidv4.hpp>
+#include <uuids/uuids.h>
+#include <uuids/uuidv7.hpp>
+
+#include <vector>
+
+namespace
+{
+
+std::vector<uuids::uuid> make_v7_column(std::size_t n)
+{
+    uuids::shared_uuid_v7_generator gen;
+    std::vector<uuids::uuid> ids(n);
+    gen.generate(ids);
+    return ids;
+}
+
+} // namespace
+
+static void BM_ExtractTimestamps(benchmark::State& state)
+{
+    const auto ids = make_v7_column(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint64_t> out(ids.size());
+
+    for (auto _ : state)
+    {
+        uuids::extract_timestamps(std::span<const uuids::uuid>(ids), out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ExtractTimestamps)->Arg(1 << 20);
+
+static void BM_FilterTimeRange(benchmark::State& state)
+{
+    const auto ids = make_v7_column(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::size_t> out(ids.size());
+    const auto t0 = uuids::detail::unix_ms_of(ids[ids.size() / 4].bytes().data());
+    const auto t1 = uuids::detail::unix_ms_of(ids[ids.size() / 2].bytes().data());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            uuids::filter_time_range(std::span<const uuids::uuid>(ids), t0, t1, out));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FilterTimeRange)->Arg(1 << 20);
+
+static void BM_ValidateMany(benchmark::State& state)
+{
+    const auto ids = make_v7_column(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint64_t> bitmap((ids.size() + 63) / 64);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(uuids::validate_many(
+            std::span<const uuids::uuid>(ids), uuids::version_bit(7), bitmap));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValidateMany)->Arg(1 << 13)->Arg(1 << 20);
+
+static void BM_VersionHistogram(benchmark::State& state)
+{
+    const auto ids = make_v7_column(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(uuids::version_histogram(std::span<const uuids::uuid>(ids)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VersionHistogram)->Arg(1 << 13)->Arg(1 << 20);
+
+static void BM_HashLoop(benchmark::State& state)
+{
+    const auto ids = make_v7_column(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint64_t> out(ids.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < ids.size(); ++i)
+        {
+            out[i] = std::hash<uuids::uuid>{}(ids[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HashLoop)->Arg(1 << 13)->Arg(1 << 20);
+
+static void BM_HashMany(benchmark::State& state)
+{
+    const auto ids = make_v7_column(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint64_t> out(ids.size());
+    for (auto _ : state)
+    {
+        uuids::hash_many(std::span<const uuids::uuid>(ids), out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HashMany)->Arg(1 << 13)->Arg(1 << 20);
+
+static void BM_RandomnessTester(benchmark::State& state)
+{
+    uuids::basic_uuid_generator<std::mt19937_64> gen(1);
+    std::vector<uuids::uuid> ids(static_cast<std::size_t>(state.range(0)));
+    for (auto& id : ids)
+    {
+        id = gen();
+    }
+
+    uuids::randomness_tester tester;
+    for (auto _ : state)
+    {
+        tester.add(ids);
+    }
+    benchmark::DoNotOptimize(tester.report());
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 16);
+}
+BENCHMARK(BM_RandomnessTester)->Arg(1 << 16)->Arg(1 << 22);
+
+namespace
+{
+
+struct lookup_fixture
+{
+    explicit lookup_fixture(std::size_t entries)
+    {
+        uuids::uuid_generator gen;
+        map.reserve(entries);
+        std::vector<uuids::uuid> keys(entries);
+        for (std::size_t i = 0; i < entries; ++i)
+        {
+            keys[i] = gen();
+            map.try_emplace(keys[i], i);
+        }
+
+        std::mt19937_64 pick(42);
+        probes.resize(1 << 20);
+        for (auto& probe : probes)
+        {
+            probe = keys[pick() % entries];
+        }
+    }
+
+    // Consecutive requests use different keys, so a batch does not hit lines cached by the last.
+    [[nodiscard]] std::span<const uuids::uuid> next_batch() noexcept
+    {
+        offset = (offset + batch) % probes.size();
+        return std::span<const uuids::uuid>(probes).subspan(offset, batch);
+    }
+
+    static constexpr std::size_t batch = 1024;
+
+    uuids::uuid_map<std::uint64_t> map;
+    std::vector<uuids::uuid> probes;
+    std::size_t offset = 0;
+};
+
+} // namespace
+
+static void BM_FindLoop(benchmark::State& state)
+{
+    lookup_fixture fixture(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (const auto& probe : fixture.next_batch())
+        {
+            sum += fixture.map.find(probe)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(lookup_fixture::batch));
+}
+BENCHMARK(BM_FindLoop)->Arg(1 << 12)->Arg(1 << 22);
+
+static void BM_LookupMany(benchmark::State& state)
+{
+    lookup_fixture fixture(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        fixture.map.lookup_many(fixture.next_batch(),
+                                [&](std::size_t, const auto* entry) { sum += entry->second; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(lookup_fixture::batch));
+}
+BENCHMARK(BM_LookupMany)->Arg(1 << 12)->Arg(1 << 22);
+
+static void BM_LogTextFormat(benchmark::State& state)
+{
+    const auto id = uuids::uuid_generator{}();
+    std::string line;
+
+    for (auto _ : state)
+    {
+        line.clear();
+        line.append("request ").append(id.str());
+        benchmark::DoNotOptimize(line.data());
+    }
+}
+BENCHMARK(BM_LogTextFormat);
+
+static void BM_LogBinaryRecord(benchmark::State& state)
+{
+    const auto id = uuids::uuid_generator{}();
+    uuids::binary_log log;
+    std::size_t written = 0;
+
+    for (auto _ : state)
+    {
+        uuids::log_record record;
+        record.add("request").add(id);
+        if (!log.write(record))
+        {
+            state.PauseTiming();
+            log.drain([](auto) {});
+            state.ResumeTiming();
+        }
+        ++written;
+    }
+    benchmark::DoNotOptimize(written);
+}
+BENCHMARK(BM_LogBinaryRecord);
+
+static void BM_TraceparentNewAndFormat(benchmark::State& state)
+{
+    uuids::trace_id_generator gen;
+    const uuids::trace_sampler sampler(0.1);
+    char header[uuids::traceparent_size];
+
+    for (auto _ : state)
+    {
+        uuids::format_traceparent(gen.new_trace(sampler), header);
+        benchmark::DoNotOptimize(header);
+    }
+}
+BENCHMARK(BM_TraceparentNewAndFormat);
+
+static void BM_TraceparentParse(benchmark::State& state)
+{
+    const std::string header = uuids::to_traceparent(uuids::trace_id_generator{}.new_trace());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(uuids::parse_traceparent(header));
+    }
+}
+BENCHMARK(BM_TraceparentParse);
+
+static void BM_SeedRandomDevice(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::mt19937_64 engine(std::random_device{}());
+        benchmark::DoNotOptimize(engine());
+    }
+}
+BENCHMARK(BM_SeedRandomDevice);
+
+static void BM_SeedFromEntropyPool(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto engine = uuids::seeded_engine<std::mt19937_64>();
+        benchmark::DoNotOptimize(engine());
+    }
+}
+BENCHMARK(BM_SeedFromEntropyPool);
+
+static void BM_GetrandomPerWord(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::uint64_t word = 0;
+        benchmark::DoNotOptimize(::getrandom(&word, sizeof(word), 0));
+        benchmark::DoNotOptimize(word);
+    }
+}
+BENCHMARK(BM_GetrandomPerWord);
+
+static void BM_OsEntropyEngine(benchmark::State& state)
+{
+    uuids::os_entropy_engine engine;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(engine());
+    }
+}
+BENCHMARK(BM_OsEntropyEngine);
+
+// Per-item cost of the C ABI at FFI batch sizes; Arg(1) approximates one crossing per ID.
+static void BM_CApiGenerateAndFormat(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    std::vector<std::uint8_t> ids(16 * n);
+    std::vector<char> text(UUIDS_TEXT_SIZE * n);
+    for (auto _ : state)
+    {
+        uuids_generate_v4(ids.data(), n);
+        uuids_format_many(ids.data(), n, text.data());
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CApiGenerateAndFormat)->Arg(1)->Arg(4096);
 
 BENCHMARK_MAIN();
@@ -8,6 +8,7 @@
 #include <string_view>
 #include <thread>
 #include <unordered_map>
+#include <uuids/trace.hpp>
 #include <uuids/uuidv4.hpp>
 
 struct UuidEqual
@@ -26,6 +27,7 @@ private:
         std::chrono::steady_clock::time_point start_time;
         std::string endpoint;
         std::string client_ip;
+        uuids::trace_context trace;
         int status_code{0};
     };
 
@@ -35,19 +37,23 @@ private:
     RequestMap active_requests_;
     mutable std::shared_mutex mutex_;
     uuids::uuid_generator generator_;
+    uuids::trace_id_generator tracer_;
+    uuids::trace_sampler sampler_{0.1};
     std::atomic<std::uint64_t> active_count_{0};
     std::atomic<std::uint64_t> completed_count_{0};
 
 public:
     [[nodiscard]] uuids::uuid start_request(std::string_view endpoint, std::string_view client_ip)
     {
-        auto request_id = generator_();
         auto now = std::chrono::steady_clock::now();
+        uuids::uuid request_id;
 
         {
             std::unique_lock lock(mutex_);
-            active_requests_.emplace(
-                request_id, RequestInfo{now, std::string{endpoint}, std::string{client_ip}});
+            request_id = generator_();
+            active_requests_.emplace(request_id,
+                                     RequestInfo{now, std::string{endpoint}, std::string{client_ip},
+                                                 tracer_.new_trace(sampler_)});
         }
 
         active_count_.fetch_add(1, std::memory_order_relaxed);
@@ -65,8 +71,9 @@ public:
             auto duration = std::chrono::steady_clock::now() - info.start_time;
             auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
 
-            std::cout << std::format("Request {} completed: {} {} - {} ({}ms)\n", id.str(),
-                                     info.endpoint, info.client_ip, status_code, ms);
+            std::cout << std::format("Request {} completed: {} {} - {} ({}ms) traceparent: {}\n",
+                                     id.str(), info.endpoint, info.client_ip, status_code, ms,
+                                     uuids::to_traceparent(info.trace));
 
             active_requests_.erase(it);
             active_count_.fetch_sub(1, std::memory_order_relaxed);
@@ -57,7 +57,6 @@ private:
 
 void benchmark_custom_prng()
 {
-    using xorshift_uuid = uuids::basic_uuid<xorshift128plus>;
     using xorshift_generator = uuids::basic_uuid_generator<xorshift128plus>;
 
     uuids::uuid_generator std_generator;
@@ -75,7 +74,7 @@ void benchmark_custom_prng()
                   [&](int) { std_uuids.push_back(std_generator()); });
     auto std_end = std::chrono::high_resolution_clock::now();
 
-    std::vector<xorshift_uuid> custom_uuids;
+    std::vector<uuids::uuid> custom_uuids;
     custom_uuids.reserve(NUM_UUIDS);
 
     std::for_each(std::execution::par_unseq, indices.begin(), indices.end(),
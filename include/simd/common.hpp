@@ -68,6 +68,12 @@
 #define SIMD_UNROLL_LOOPS
 #define SIMD_ALWAYS_INLINE SIMD_INLINE
 #define SIMD_NEVER_INLINE SIMD_NOINLINE
+#define SIMD_TARGET(isa)
+#if SIMD_ARCH_X86
+#define SIMD_PREFETCH(addr) _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
+#else
+#define SIMD_PREFETCH(addr) ((void)(addr))
+#endif
 #elif SIMD_COMPILER_GCC || SIMD_COMPILER_CLANG
 #define SIMD_INLINE inline __attribute__((always_inline))
 #define SIMD_NOINLINE __attribute__((noinline))
@@ -78,6 +84,8 @@
 #define SIMD_VECTORCALL
 #define SIMD_ALWAYS_INLINE SIMD_INLINE
 #define SIMD_NEVER_INLINE SIMD_NOINLINE
+#define SIMD_TARGET(isa) __attribute__((target(isa)))
+#define SIMD_PREFETCH(addr) __builtin_prefetch((addr), 0, 3)
 
 #if SIMD_COMPILER_CLANG
 #define SIMD_UNROLL_LOOPS _Pragma("clang loop unroll(enable)")
@@ -96,6 +104,8 @@
 #define SIMD_UNROLL_LOOPS
 #define SIMD_ALWAYS_INLINE SIMD_INLINE
 #define SIMD_NEVER_INLINE SIMD_NOINLINE
+#define SIMD_TARGET(isa)
+#define SIMD_PREFETCH(addr) ((void)(addr))
 #endif
 
 #define SIMD_SUPPORT_VERSION_MAJOR 0
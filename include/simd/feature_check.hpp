@@ -164,7 +164,8 @@ private:
     {
 #if SIMD_COMPILER_MSVC
         return _xgetbv(xcr);
-#elif (SIMD_COMPILER_GCC || SIMD_COMPILER_CLANG) && defined(__XSAVE__)
+#elif SIMD_COMPILER_GCC || SIMD_COMPILER_CLANG
+        // Plain asm needs no -mxsave; callers only get here once CPUID reports OSXSAVE.
         uint32_t eax, edx;
         __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(xcr));
         return (static_cast<uint64_t>(edx) << 32) | eax;
@@ -0,0 +1,362 @@
+#ifndef ARROW_HPP_q8v3mt
+#define ARROW_HPP_q8v3mt
+
+// UUID columns in Apache Arrow's in-memory layout, without depending on Arrow: a
+// FixedSizeBinary(16) array is a values buffer of 16 bytes per slot plus an optional validity
+// bitmap (bit i, least significant first, set iff slot i is not null). Views borrow such buffers
+// as uuids; columns own 64-byte aligned, 64-byte padded buffers that Arrow can wrap as they are.
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <uuids/uuid.hpp>
+
+namespace uuids::inline v1
+{
+
+namespace detail
+{
+
+inline constexpr std::size_t arrow_alignment = 64;
+
+[[nodiscard]] constexpr std::size_t arrow_padded(std::size_t bytes) noexcept
+{
+    return (bytes + arrow_alignment - 1) & ~(arrow_alignment - 1);
+}
+
+struct arrow_buffer_deleter final
+{
+    std::pmr::memory_resource* resource{nullptr};
+    std::size_t size{0};
+
+    void operator()(std::byte* memory) const noexcept
+    {
+        resource->deallocate(memory, size, arrow_alignment);
+    }
+};
+
+using arrow_buffer = std::unique_ptr<std::byte[], arrow_buffer_deleter>;
+
+// Zero-filled, so the padding past the last slot never carries stale heap contents.
+[[nodiscard]] inline arrow_buffer allocate_arrow_buffer(std::size_t bytes,
+                                                        std::pmr::memory_resource* resource)
+{
+    const std::size_t padded = arrow_padded(bytes);
+    auto* memory = static_cast<std::byte*>(resource->allocate(padded, arrow_alignment));
+    std::memset(memory, 0, padded);
+    return arrow_buffer(memory, arrow_buffer_deleter{resource, padded});
+}
+
+[[nodiscard]] constexpr bool arrow_bit(const std::uint8_t* bitmap, std::size_t i) noexcept
+{
+    return ((bitmap[i / 8] >> (i % 8)) & 1) != 0;
+}
+
+[[nodiscard]] inline std::size_t arrow_count_set(const std::uint8_t* bitmap, std::size_t first,
+                                                 std::size_t count) noexcept
+{
+    std::size_t set = 0;
+    std::size_t i = first;
+    const std::size_t end = first + count;
+    for (; i < end && i % 8 != 0; ++i)
+    {
+        set += arrow_bit(bitmap, i) ? 1u : 0u;
+    }
+    for (; i + 8 <= end; i += 8)
+    {
+        set += static_cast<std::size_t>(std::popcount(bitmap[i / 8]));
+    }
+    for (; i < end; ++i)
+    {
+        set += arrow_bit(bitmap, i) ? 1u : 0u;
+    }
+    return set;
+}
+
+template <typename Generator>
+concept BatchUuidGenerator = requires(Generator& generator, std::span<uuid> out) {
+    generator.generate(out);
+};
+
+template <typename Generator>
+concept UuidGenerator = requires(Generator& generator) {
+    { generator() } -> std::convertible_to<uuid>;
+};
+
+} // namespace detail
+
+// Borrows a FixedSizeBinary(16) array: length slots starting at slot offset of values, with
+// validity bit offset + i describing slot i. A null validity pointer means no slot is null, as
+// in Arrow. Nothing is copied; the buffers must outlive the view.
+class arrow_uuid_view final
+{
+public:
+    constexpr arrow_uuid_view() noexcept = default;
+
+    // Throws std::invalid_argument unless the first slot is 16-byte aligned, which Arrow's
+    // 8- or 64-byte buffer alignment guarantees in practice but does not promise.
+    arrow_uuid_view(const void* values, const std::uint8_t* validity, std::size_t length,
+                    std::size_t offset = 0)
+        : validity_{validity}, length_{length}, offset_{offset}
+    {
+        static_assert(sizeof(uuid) == 16 && std::is_standard_layout_v<uuid> &&
+                      std::is_trivially_copyable_v<uuid>);
+
+        const auto* first = static_cast<const std::byte*>(values) + 16 * offset;
+        if (length != 0 && reinterpret_cast<std::uintptr_t>(first) % alignof(uuid) != 0)
+        {
+            throw std::invalid_argument("arrow uuid values are not 16-byte aligned");
+        }
+        ids_ = reinterpret_cast<const uuid*>(first);
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return length_; }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return length_ == 0; }
+
+    // Every slot, nulls included; a null slot holds whatever bytes the producer left there.
+    [[nodiscard]] constexpr std::span<const uuid> ids() const noexcept
+    {
+        return std::span<const uuid>(ids_, length_);
+    }
+
+    [[nodiscard]] constexpr bool is_valid(std::size_t i) const noexcept
+    {
+        return validity_ == nullptr || detail::arrow_bit(validity_, offset_ + i);
+    }
+
+    [[nodiscard]] constexpr std::optional<uuid> operator[](std::size_t i) const noexcept
+    {
+        if (!is_valid(i))
+        {
+            return std::nullopt;
+        }
+        return ids_[i];
+    }
+
+    [[nodiscard]] std::size_t null_count() const noexcept
+    {
+        if (validity_ == nullptr)
+        {
+            return 0;
+        }
+        return length_ - detail::arrow_count_set(validity_, offset_, length_);
+    }
+
+    [[nodiscard]] constexpr const std::uint8_t* validity() const noexcept { return validity_; }
+
+    [[nodiscard]] constexpr std::size_t offset() const noexcept { return offset_; }
+
+private:
+    const uuid* ids_{nullptr};
+    const std::uint8_t* validity_{nullptr};
+    std::size_t length_{0};
+    std::size_t offset_{0};
+};
+
+// Owns a FixedSizeBinary(16) array at offset 0, with both buffers taken from one memory
+// resource. The validity bitmap is only allocated once a slot is made null, so columns without
+// nulls hand Arrow a null validity buffer.
+class arrow_uuid_column final
+{
+public:
+    arrow_uuid_column() : arrow_uuid_column(0) {}
+
+    explicit arrow_uuid_column(std::size_t length)
+        : arrow_uuid_column(length, std::pmr::get_default_resource())
+    {
+    }
+
+    arrow_uuid_column(std::size_t length, std::pmr::memory_resource* resource)
+        : values_{detail::allocate_arrow_buffer(16 * length, resource)}, length_{length}
+    {
+    }
+
+    // A moved-from column is empty, not a length over a null buffer.
+    arrow_uuid_column(arrow_uuid_column&& other) noexcept
+        : values_{std::move(other.values_)}, validity_{std::move(other.validity_)},
+          length_{std::exchange(other.length_, 0)},
+          null_count_{std::exchange(other.null_count_, 0)}
+    {
+    }
+
+    arrow_uuid_column& operator=(arrow_uuid_column&& other) noexcept
+    {
+        values_ = std::move(other.values_);
+        validity_ = std::move(other.validity_);
+        length_ = std::exchange(other.length_, 0);
+        null_count_ = std::exchange(other.null_count_, 0);
+        return *this;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return length_; }
+
+    [[nodiscard]] std::span<uuid> ids() noexcept
+    {
+        return std::span<uuid>(reinterpret_cast<uuid*>(values_.get()), length_);
+    }
+
+    [[nodiscard]] std::span<const uuid> ids() const noexcept
+    {
+        return std::span<const uuid>(reinterpret_cast<const uuid*>(values_.get()), length_);
+    }
+
+    // The buffers exactly as Arrow expects them, padding included; validity_buffer() is empty
+    // while the column has no nulls.
+    [[nodiscard]] std::span<const std::byte> values_buffer() const noexcept
+    {
+        return std::span<const std::byte>(values_.get(), detail::arrow_padded(16 * length_));
+    }
+
+    [[nodiscard]] std::span<const std::byte> validity_buffer() const noexcept
+    {
+        if (!validity_)
+        {
+            return {};
+        }
+        return std::span<const std::byte>(validity_.get(), detail::arrow_padded((length_ + 7) / 8));
+    }
+
+    [[nodiscard]] std::size_t null_count() const noexcept { return null_count_; }
+
+    [[nodiscard]] bool is_valid(std::size_t i) const noexcept
+    {
+        return !validity_ || detail::arrow_bit(validity_bits(), i);
+    }
+
+    // Nulls slot i and zeroes its bytes.
+    void set_null(std::size_t i)
+    {
+        if (!validity_)
+        {
+            validity_ = detail::allocate_arrow_buffer((length_ + 7) / 8, resource());
+            std::memset(validity_.get(), 0xFF, length_ / 8);
+            for (std::size_t bit = length_ & ~std::size_t{7}; bit < length_; ++bit)
+            {
+                validity_[bit / 8] |= std::byte{1} << (bit % 8);
+            }
+        }
+        if (is_valid(i))
+        {
+            validity_[i / 8] &= ~(std::byte{1} << (i % 8));
+            ++null_count_;
+        }
+        ids()[i] = uuid();
+    }
+
+    [[nodiscard]] std::pmr::memory_resource* resource() const noexcept
+    {
+        return values_.get_deleter().resource;
+    }
+
+    [[nodiscard]] arrow_uuid_view view() const
+    {
+        return arrow_uuid_view(values_.get(), validity_ ? validity_bits() : nullptr, length_);
+    }
+
+private:
+    [[nodiscard]] const std::uint8_t* validity_bits() const noexcept
+    {
+        return reinterpret_cast<const std::uint8_t*>(validity_.get());
+    }
+
+    detail::arrow_buffer values_;
+    detail::arrow_buffer validity_;
+    std::size_t length_{0};
+    std::size_t null_count_{0};
+};
+
+// Fills a new column with n IDs, straight into the Arrow values buffer. Batch generators (the
+// v7 generators) reserve their timestamps once for the whole column.
+template <typename Generator>
+    requires detail::BatchUuidGenerator<Generator> || detail::UuidGenerator<Generator>
+[[nodiscard]] arrow_uuid_column
+generate_arrow_column(Generator& generator, std::size_t n,
+                      std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+{
+    arrow_uuid_column column(n, resource);
+    if constexpr (detail::BatchUuidGenerator<Generator>)
+    {
+        generator.generate(column.ids());
+    }
+    else
+    {
+        for (uuid& id : column.ids())
+        {
+            id = generator();
+        }
+    }
+    return column;
+}
+
+// Parses canonical (36) or bare (32 character) text; malformed entries become nulls.
+[[nodiscard]] inline arrow_uuid_column
+parse_arrow_column(std::span<const std::string_view> texts,
+                   std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+{
+    arrow_uuid_column column(texts.size(), resource);
+    const std::span<uuid> ids = column.ids();
+    for (std::size_t i = 0; i < texts.size(); ++i)
+    {
+        const std::optional<uuid> id = uuid::parse(texts[i]);
+        if (id)
+        {
+            ids[i] = *id;
+        }
+        else
+        {
+            column.set_null(i);
+        }
+    }
+    return column;
+}
+
+// Parses an Arrow Utf8 (int32_t offsets) or LargeUtf8 (int64_t offsets) array in place:
+// slot i is data[offsets[i], offsets[i + 1]). Null and malformed strings become nulls.
+template <typename Offset>
+    requires std::same_as<Offset, std::int32_t> || std::same_as<Offset, std::int64_t>
+[[nodiscard]] arrow_uuid_column
+parse_arrow_column(const Offset* offsets, const char* data, const std::uint8_t* validity,
+                   std::size_t length, std::size_t offset = 0,
+                   std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+{
+    arrow_uuid_column column(length, resource);
+    const std::span<uuid> ids = column.ids();
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        const std::size_t slot = offset + i;
+        if (validity != nullptr && !detail::arrow_bit(validity, slot))
+        {
+            column.set_null(i);
+            continue;
+        }
+
+        const auto begin = static_cast<std::size_t>(offsets[slot]);
+        const auto end = static_cast<std::size_t>(offsets[slot + 1]);
+        const std::optional<uuid> id = uuid::parse(std::string_view(data + begin, end - begin));
+        if (id)
+        {
+            ids[i] = *id;
+        }
+        else
+        {
+            column.set_null(i);
+        }
+    }
+    return column;
+}
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: ARROW_HPP_q8v3mt */
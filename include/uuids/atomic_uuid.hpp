@@ -0,0 +1,334 @@
+#ifndef ATOMIC_UUID_HPP_q7m3vd
+#define ATOMIC_UUID_HPP_q7m3vd
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <random>
+
+#include <simd/common.hpp>
+#include <uuids/uuidv4.hpp>
+
+#if defined(_MSC_VER) && (defined(__x86_64__) || defined(_M_X64))
+#include <intrin.h>
+#pragma intrinsic(_InterlockedCompareExchange128)
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define UUIDS_ATOMIC_CMPXCHG16B 1
+#else
+#define UUIDS_ATOMIC_CMPXCHG16B 0
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_ATOMICS) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define UUIDS_ATOMIC_CASP 1
+#else
+#define UUIDS_ATOMIC_CASP 0
+#endif
+
+namespace uuids::inline v1
+{
+
+namespace detail
+{
+
+struct alignas(16) uuid_words final
+{
+    std::uint64_t lo;
+    std::uint64_t hi;
+
+    [[nodiscard]] friend constexpr bool operator==(const uuid_words&,
+                                                   const uuid_words&) noexcept = default;
+};
+
+[[nodiscard]] inline uuid_words to_words(const uuid_bytes& bytes) noexcept
+{
+    uuid_words words;
+    std::memcpy(&words.lo, bytes.data.data(), 8);
+    std::memcpy(&words.hi, bytes.data.data() + 8, 8);
+    return words;
+}
+
+[[nodiscard]] inline uuid_bytes from_words(const uuid_words& words) noexcept
+{
+    uuid_bytes bytes;
+    std::memcpy(bytes.data.data(), &words.lo, 8);
+    std::memcpy(bytes.data.data() + 8, &words.hi, 8);
+    return bytes;
+}
+
+#if UUIDS_ATOMIC_CMPXCHG16B || UUIDS_ATOMIC_CASP
+
+class cas128_storage final
+{
+public:
+    static constexpr bool is_always_lock_free = true;
+
+    constexpr cas128_storage() noexcept : words_{} {}
+
+    explicit constexpr cas128_storage(uuid_words words) noexcept : words_{words} {}
+
+    [[nodiscard]] uuid_words load() const noexcept
+    {
+#if UUIDS_ATOMIC_CMPXCHG16B && (SIMD_COMPILER_GCC || SIMD_COMPILER_CLANG)
+        // Aligned 16-byte vector loads are single-copy atomic on every CPU that implements AVX,
+        // which lets readers avoid pulling the line exclusive with a locked cmpxchg16b.
+        if constexpr (simd::compile_time::has<simd::Feature::AVX>())
+        {
+            const __m128i value = _mm_load_si128(reinterpret_cast<const __m128i*>(&words_));
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+            uuid_words result;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&result), value);
+            return result;
+        }
+#endif
+        uuid_words expected{};
+        const_cast<cas128_storage*>(this)->cas(expected, expected);
+        return expected;
+    }
+
+    void store(uuid_words desired) noexcept
+    {
+        uuid_words expected = load();
+        while (!cas(expected, desired))
+        {
+        }
+    }
+
+    [[nodiscard]] uuid_words exchange(uuid_words desired) noexcept
+    {
+        uuid_words expected = load();
+        while (!cas(expected, desired))
+        {
+        }
+        return expected;
+    }
+
+    [[nodiscard]] bool compare_exchange(uuid_words& expected, uuid_words desired) noexcept
+    {
+        return cas(expected, desired);
+    }
+
+private:
+    bool cas(uuid_words& expected, uuid_words desired) noexcept
+    {
+#if UUIDS_ATOMIC_CMPXCHG16B && SIMD_COMPILER_MSVC
+        auto* comparand = reinterpret_cast<long long*>(&expected);
+        return _InterlockedCompareExchange128(reinterpret_cast<volatile long long*>(&words_),
+                                              static_cast<long long>(desired.hi),
+                                              static_cast<long long>(desired.lo), comparand) != 0;
+#elif UUIDS_ATOMIC_CMPXCHG16B
+        bool ok;
+        __asm__ __volatile__("lock cmpxchg16b %1"
+                             : "=@ccz"(ok), "+m"(words_), "+a"(expected.lo), "+d"(expected.hi)
+                             : "b"(desired.lo), "c"(desired.hi)
+                             : "memory");
+        return ok;
+#else
+        register std::uint64_t x0 __asm__("x0") = expected.lo;
+        register std::uint64_t x1 __asm__("x1") = expected.hi;
+        register std::uint64_t x2 __asm__("x2") = desired.lo;
+        register std::uint64_t x3 __asm__("x3") = desired.hi;
+        __asm__ __volatile__("caspal %[e0], %[e1], %[d0], %[d1], %[mem]"
+                             : [e0] "+r"(x0), [e1] "+r"(x1), [mem] "+Q"(words_)
+                             : [d0] "r"(x2), [d1] "r"(x3)
+                             : "memory");
+        const bool ok = x0 == expected.lo && x1 == expected.hi;
+        expected.lo = x0;
+        expected.hi = x1;
+        return ok;
+#endif
+    }
+
+    uuid_words words_;
+};
+
+using atomic_uuid_storage = cas128_storage;
+
+#else
+
+class seqlock_storage final
+{
+public:
+    static constexpr bool is_always_lock_free = false;
+
+    constexpr seqlock_storage() noexcept = default;
+
+    explicit constexpr seqlock_storage(uuid_words words) noexcept : lo_{words.lo}, hi_{words.hi}
+    {
+    }
+
+    [[nodiscard]] uuid_words load() const noexcept
+    {
+        for (;;)
+        {
+            const std::uint64_t before = seq_.load(std::memory_order_acquire);
+            if ((before & 1) != 0)
+            {
+                continue;
+            }
+
+            const uuid_words words{lo_.load(std::memory_order_relaxed),
+                                   hi_.load(std::memory_order_relaxed)};
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (seq_.load(std::memory_order_relaxed) == before)
+            {
+                return words;
+            }
+        }
+    }
+
+    void store(uuid_words desired) noexcept
+    {
+        const std::uint64_t seq = lock();
+        write(desired);
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    [[nodiscard]] uuid_words exchange(uuid_words desired) noexcept
+    {
+        const std::uint64_t seq = lock();
+        const uuid_words previous = read_locked();
+        write(desired);
+        seq_.store(seq + 2, std::memory_order_release);
+        return previous;
+    }
+
+    [[nodiscard]] bool compare_exchange(uuid_words& expected, uuid_words desired) noexcept
+    {
+        const std::uint64_t seq = lock();
+        const uuid_words current = read_locked();
+        const bool ok = current == expected;
+
+        if (ok)
+        {
+            write(desired);
+            seq_.store(seq + 2, std::memory_order_release);
+        }
+        else
+        {
+            expected = current;
+            seq_.store(seq, std::memory_order_release);
+        }
+
+        return ok;
+    }
+
+private:
+    std::uint64_t lock() noexcept
+    {
+        std::uint64_t seq = seq_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if ((seq & 1) == 0 &&
+                seq_.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire,
+                                           std::memory_order_relaxed))
+            {
+                std::atomic_thread_fence(std::memory_order_release);
+                return seq;
+            }
+            seq = seq_.load(std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] uuid_words read_locked() const noexcept
+    {
+        return uuid_words{lo_.load(std::memory_order_relaxed), hi_.load(std::memory_order_relaxed)};
+    }
+
+    void write(uuid_words words) noexcept
+    {
+        lo_.store(words.lo, std::memory_order_relaxed);
+        hi_.store(words.hi, std::memory_order_relaxed);
+    }
+
+    std::atomic<std::uint64_t> seq_{0};
+    std::atomic<std::uint64_t> lo_{0};
+    std::atomic<std::uint64_t> hi_{0};
+};
+
+using atomic_uuid_storage = seqlock_storage;
+
+#endif
+
+} // namespace detail
+
+class atomic_uuid final
+{
+public:
+    using value_type = uuid;
+
+    static constexpr bool is_always_lock_free = detail::atomic_uuid_storage::is_always_lock_free;
+
+    constexpr atomic_uuid() noexcept = default;
+
+    explicit atomic_uuid(const value_type& value) noexcept
+        : storage_{detail::to_words(detail::uuid_bytes{value.bytes()})}
+    {
+    }
+
+    atomic_uuid(const atomic_uuid&) = delete;
+    atomic_uuid& operator=(const atomic_uuid&) = delete;
+
+    [[nodiscard]] bool is_lock_free() const noexcept { return is_always_lock_free; }
+
+    [[nodiscard]] value_type load(std::memory_order = std::memory_order_seq_cst) const noexcept
+    {
+        return value_type(detail::from_words(storage_.load()));
+    }
+
+    void store(const value_type& desired,
+               std::memory_order = std::memory_order_seq_cst) noexcept
+    {
+        storage_.store(words_of(desired));
+    }
+
+    [[nodiscard]] value_type exchange(const value_type& desired,
+                                      std::memory_order = std::memory_order_seq_cst) noexcept
+    {
+        return value_type(detail::from_words(storage_.exchange(words_of(desired))));
+    }
+
+    bool compare_exchange_strong(value_type& expected, const value_type& desired,
+                                 std::memory_order = std::memory_order_seq_cst) noexcept
+    {
+        detail::uuid_words current = words_of(expected);
+        if (storage_.compare_exchange(current, words_of(desired)))
+        {
+            return true;
+        }
+        expected = value_type(detail::from_words(current));
+        return false;
+    }
+
+    bool compare_exchange_weak(value_type& expected, const value_type& desired,
+                               std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return compare_exchange_strong(expected, desired, order);
+    }
+
+    operator value_type() const noexcept { return load(); }
+
+    atomic_uuid& operator=(const value_type& desired) noexcept
+    {
+        store(desired);
+        return *this;
+    }
+
+private:
+    [[nodiscard]] static detail::uuid_words words_of(const value_type& value) noexcept
+    {
+        return detail::to_words(detail::uuid_bytes{value.bytes()});
+    }
+
+    detail::atomic_uuid_storage storage_;
+};
+
+template <typename PRNG = std::mt19937_64>
+using basic_atomic_uuid = atomic_uuid;
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: ATOMIC_UUID_HPP_q7m3vd */
@@ -0,0 +1,431 @@
+#ifndef BINLOG_HPP_t7d3vk
+#define BINLOG_HPP_t7d3vk
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <uuids/uuid.hpp>
+
+namespace uuids::inline v1
+{
+
+enum class log_field : std::uint8_t
+{
+    uuid = 1,
+    u64 = 2,
+    i64 = 3,
+    text = 4,
+};
+
+// A log line as tagged binary fields: a uuid is its tag plus the raw 16 bytes, integers are
+// stored in host byte order, and text carries a 16-bit length. Fields that do not fit are
+// dropped and flagged, never split.
+class log_record final
+{
+public:
+    static constexpr std::size_t capacity = 256;
+
+    log_record& add(const uuid& id) noexcept
+    {
+        return put(log_field::uuid, id.bytes().data(), 16);
+    }
+
+    template <std::integral T>
+    log_record& add(T value) noexcept
+    {
+        if constexpr (std::is_signed_v<T>)
+        {
+            const auto wide = static_cast<std::int64_t>(value);
+            return put(log_field::i64, &wide, sizeof(wide));
+        }
+        else
+        {
+            const auto wide = static_cast<std::uint64_t>(value);
+            return put(log_field::u64, &wide, sizeof(wide));
+        }
+    }
+
+    log_record& add(std::string_view text) noexcept
+    {
+        if (size_ + 3 + text.size() > capacity)
+        {
+            truncated_ = true;
+            return *this;
+        }
+
+        const auto length = static_cast<std::uint16_t>(text.size());
+        data_[size_++] = static_cast<std::byte>(log_field::text);
+        std::memcpy(data_.data() + size_, &length, sizeof(length));
+        std::memcpy(data_.data() + size_ + sizeof(length), text.data(), text.size());
+        size_ += sizeof(length) + text.size();
+        return *this;
+    }
+
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept
+    {
+        return std::span<const std::byte>(data_.data(), size_);
+    }
+
+    [[nodiscard]] bool truncated() const noexcept { return truncated_; }
+
+private:
+    log_record& put(log_field tag, const void* payload, std::size_t size) noexcept
+    {
+        if (size_ + 1 + size > capacity)
+        {
+            truncated_ = true;
+            return *this;
+        }
+
+        data_[size_] = static_cast<std::byte>(tag);
+        std::memcpy(data_.data() + size_ + 1, payload, size);
+        size_ += 1 + size;
+        return *this;
+    }
+
+    std::array<std::byte, capacity> data_;
+    std::size_t size_{0};
+    bool truncated_{false};
+};
+
+// Single-producer, single-consumer byte ring of records, each framed by a 16-bit length.
+// Producers never block: a record that does not fit is counted as dropped.
+class log_ring final
+{
+public:
+    explicit log_ring(std::size_t capacity)
+        : capacity_{std::bit_ceil(std::max(capacity, 4 * (log_record::capacity + frame_size)))},
+          buffer_{std::make_unique<std::byte[]>(capacity_)}
+    {
+    }
+
+    log_ring(const log_ring&) = delete;
+    log_ring& operator=(const log_ring&) = delete;
+
+    bool try_write(std::span<const std::byte> record) noexcept
+    {
+        const std::size_t needed = frame_size + record.size();
+        const std::uint64_t head = head_.load(std::memory_order_relaxed);
+        if (needed > capacity_ - (head - cached_tail_))
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+        }
+        if (record.size() > log_record::capacity || needed > capacity_ - (head - cached_tail_))
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        const auto size = static_cast<std::uint16_t>(record.size());
+        copy_in(head, &size, frame_size);
+        copy_in(head + frame_size, record.data(), record.size());
+        head_.store(head + needed, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side; f(record) sees each record as a contiguous span valid for the call only.
+    template <typename F>
+    std::size_t drain(F&& f)
+    {
+        std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+        const std::uint64_t head = head_.load(std::memory_order_acquire);
+        std::array<std::byte, log_record::capacity> scratch;
+
+        std::size_t count = 0;
+        while (tail != head)
+        {
+            std::uint16_t size = 0;
+            copy_out(tail, &size, frame_size);
+            copy_out(tail + frame_size, scratch.data(), size);
+            f(std::span<const std::byte>(scratch.data(), size));
+            tail += frame_size + size;
+            ++count;
+        }
+
+        tail_.store(tail, std::memory_order_release);
+        return count;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] std::uint64_t dropped() const noexcept
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    void retire() noexcept { retired_.store(true, std::memory_order_release); }
+
+    [[nodiscard]] bool retired() const noexcept { return retired_.load(std::memory_order_acquire); }
+
+private:
+    static constexpr std::size_t frame_size = sizeof(std::uint16_t);
+
+    void copy_in(std::uint64_t position, const void* source, std::size_t size) noexcept
+    {
+        const std::size_t offset = position & (capacity_ - 1);
+        const std::size_t first = std::min(size, capacity_ - offset);
+        std::memcpy(buffer_.get() + offset, source, first);
+        std::memcpy(buffer_.get(), static_cast<const std::byte*>(source) + first, size - first);
+    }
+
+    void copy_out(std::uint64_t position, void* target, std::size_t size) const noexcept
+    {
+        const std::size_t offset = position & (capacity_ - 1);
+        const std::size_t first = std::min(size, capacity_ - offset);
+        std::memcpy(target, buffer_.get() + offset, first);
+        std::memcpy(static_cast<std::byte*>(target) + first, buffer_.get(), size - first);
+    }
+
+    std::size_t capacity_;
+    std::unique_ptr<std::byte[]> buffer_;
+    alignas(64) std::atomic<std::uint64_t> head_{0};
+    std::uint64_t cached_tail_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    alignas(64) std::atomic<std::uint64_t> tail_{0};
+    std::atomic<bool> retired_{false};
+};
+
+// Every writing thread gets its own ring on first use, so the logging path is a record copy and
+// one release store. drain() is the decoder side: call it from one background thread (or at
+// shutdown) and render with format_log_record(). Rings of exited threads are freed once empty.
+class binary_log final
+{
+public:
+    static constexpr std::size_t default_ring_capacity = 64 * 1024;
+
+    explicit binary_log(std::size_t ring_capacity = default_ring_capacity)
+        : id_{next_id()}, ring_capacity_{ring_capacity}
+    {
+    }
+
+    binary_log(const binary_log&) = delete;
+    binary_log& operator=(const binary_log&) = delete;
+
+    bool write(const log_record& record) noexcept
+    {
+        log_ring* ring = local_ring();
+        return ring != nullptr && ring->try_write(record.bytes());
+    }
+
+    template <typename F>
+    std::size_t drain(F&& f)
+    {
+        std::lock_guard lock(mutex_);
+        std::size_t count = 0;
+        for (const auto& ring : rings_)
+        {
+            count += ring->drain(f);
+        }
+
+        std::erase_if(rings_,
+                      [this](const std::shared_ptr<log_ring>& ring)
+                      {
+                          if (!ring->retired() || !ring->empty())
+                          {
+                              return false;
+                          }
+                          retired_dropped_ += ring->dropped();
+                          return true;
+                      });
+        return count;
+    }
+
+    [[nodiscard]] std::uint64_t dropped() const
+    {
+        std::lock_guard lock(mutex_);
+        std::uint64_t total = retired_dropped_;
+        for (const auto& ring : rings_)
+        {
+            total += ring->dropped();
+        }
+        return total;
+    }
+
+private:
+    struct thread_rings final
+    {
+        // The log owns its rings; a thread only watches them, so destroying a log frees its
+        // rings at once, and the entries left behind are dropped when the thread next adds one.
+        struct entry final
+        {
+            std::uint64_t log_id;
+            std::weak_ptr<log_ring> ring;
+            log_ring* writer;
+        };
+
+        thread_rings() = default;
+        thread_rings(const thread_rings&) = delete;
+        thread_rings& operator=(const thread_rings&) = delete;
+
+        ~thread_rings()
+        {
+            for (const auto& e : entries)
+            {
+                if (const auto ring = e.ring.lock())
+                {
+                    ring->retire();
+                }
+            }
+        }
+
+        std::vector<entry> entries;
+    };
+
+    [[nodiscard]] static std::uint64_t next_id() noexcept
+    {
+        static std::atomic<std::uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    [[nodiscard]] log_ring* local_ring() noexcept
+    {
+        thread_local thread_rings local;
+        // Log ids are never reused, and a log outlives its own write() calls, so a matching
+        // entry's ring is alive.
+        for (const auto& e : local.entries)
+        {
+            if (e.log_id == id_)
+            {
+                return e.writer;
+            }
+        }
+
+        std::erase_if(local.entries, [](const thread_rings::entry& e) { return e.ring.expired(); });
+        try
+        {
+            auto ring = std::make_shared<log_ring>(ring_capacity_);
+            local.entries.push_back({id_, ring, ring.get()});
+            std::lock_guard lock(mutex_);
+            rings_.push_back(std::move(ring));
+            return local.entries.back().writer;
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    std::uint64_t id_;
+    std::size_t ring_capacity_;
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<log_ring>> rings_;
+    std::uint64_t retired_dropped_{0};
+};
+
+// Calls f(tag, payload) for every field; returns false on a malformed record.
+template <typename F>
+bool visit_log_record(std::span<const std::byte> record, F&& f)
+{
+    while (!record.empty())
+    {
+        const auto tag = static_cast<log_field>(record[0]);
+        record = record.subspan(1);
+
+        std::size_t size = 0;
+        switch (tag)
+        {
+            case log_field::uuid:
+                size = 16;
+                break;
+            case log_field::u64:
+            case log_field::i64:
+                size = 8;
+                break;
+            case log_field::text:
+            {
+                std::uint16_t length = 0;
+                if (record.size() < sizeof(length))
+                {
+                    return false;
+                }
+                std::memcpy(&length, record.data(), sizeof(length));
+                record = record.subspan(sizeof(length));
+                size = length;
+                break;
+            }
+            default:
+                return false;
+        }
+
+        if (record.size() < size)
+        {
+            return false;
+        }
+        f(tag, record.first(size));
+        record = record.subspan(size);
+    }
+    return true;
+}
+
+namespace detail
+{
+
+inline void append_log_field(log_field tag, std::span<const std::byte> payload, std::string& out)
+{
+    switch (tag)
+    {
+        case log_field::uuid:
+        {
+            std::array<std::uint8_t, 16> bytes;
+            std::memcpy(bytes.data(), payload.data(), bytes.size());
+            const std::size_t at = out.size();
+            out.resize(at + 36);
+            format_uuid(bytes, out.data() + at);
+            break;
+        }
+        case log_field::u64:
+        case log_field::i64:
+        {
+            std::uint64_t raw = 0;
+            std::memcpy(&raw, payload.data(), sizeof(raw));
+            char digits[24];
+            const auto result = tag == log_field::u64
+                                    ? std::to_chars(digits, digits + sizeof(digits), raw)
+                                    : std::to_chars(digits, digits + sizeof(digits),
+                                                    static_cast<std::int64_t>(raw));
+            out.append(digits, result.ptr);
+            break;
+        }
+        case log_field::text:
+            out.append(reinterpret_cast<const char*>(payload.data()), payload.size());
+            break;
+    }
+}
+
+} // namespace detail
+
+// Appends the fields separated by single spaces, uuids in canonical form.
+inline bool format_log_record(std::span<const std::byte> record, std::string& out)
+{
+    bool first = true;
+    return visit_log_record(record,
+                            [&](log_field tag, std::span<const std::byte> payload)
+                            {
+                                if (!std::exchange(first, false))
+                                {
+                                    out.push_back(' ');
+                                }
+                                detail::append_log_field(tag, payload, out);
+                            });
+}
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: BINLOG_HPP_t7d3vk */
@@ -0,0 +1,439 @@
+#ifndef BULK_HPP_n2j7xc
+#define BULK_HPP_n2j7xc
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <type_traits>
+
+#include <simd/common.hpp>
+#include <simd/feature_check.hpp>
+#include <uuids/uuidv4.hpp>
+
+namespace uuids::inline v1
+{
+
+namespace detail
+{
+
+[[nodiscard]] inline const std::uint8_t* column_bytes(std::span<const uuid> ids) noexcept
+{
+    static_assert(sizeof(uuid) == 16 && std::is_standard_layout_v<uuid>);
+    return reinterpret_cast<const std::uint8_t*>(ids.data());
+}
+
+[[nodiscard]] inline bool avx2_supported() noexcept
+{
+    static const bool supported = simd::has_feature(simd::Feature::AVX2);
+    return supported;
+}
+
+[[nodiscard]] inline std::uint64_t load_be64(const std::uint8_t* p) noexcept
+{
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        value = (value << 8) | p[i];
+    }
+    return value;
+}
+
+// 100 ns intervals between the Gregorian epoch (1582-10-15) used by v1/v6 and the Unix epoch.
+inline constexpr std::uint64_t gregorian_to_unix_100ns = 0x01B21DD213814000ULL;
+
+[[nodiscard]] inline std::uint64_t unix_ms_of(const std::uint8_t* id) noexcept
+{
+    const std::uint64_t head = load_be64(id);
+
+    switch (id[6] >> 4)
+    {
+        case 7:
+            return head >> 16;
+        case 1:
+        {
+            const std::uint64_t time_low = head >> 32;
+            const std::uint64_t time_mid = (head >> 16) & 0xFFFF;
+            const std::uint64_t time_hi = head & 0x0FFF;
+            const std::uint64_t ticks = (time_hi << 48) | (time_mid << 32) | time_low;
+            return ticks >= gregorian_to_unix_100ns ? (ticks - gregorian_to_unix_100ns) / 10'000
+                                                    : 0;
+        }
+        case 6:
+        {
+            const std::uint64_t ticks = ((head >> 16) << 12) | (head & 0x0FFF);
+            return ticks >= gregorian_to_unix_100ns ? (ticks - gregorian_to_unix_100ns) / 10'000
+                                                    : 0;
+        }
+        default:
+            return 0;
+    }
+}
+
+// Versions 1, 6 and 7; unix_ms_of() is 0 for every other ID, which is not a time.
+[[nodiscard]] constexpr bool has_timestamp(const std::uint8_t* id) noexcept
+{
+    const unsigned version = id[6] >> 4u;
+    return version == 1 || version == 6 || version == 7;
+}
+
+[[nodiscard]] constexpr bool valid_id(const std::uint8_t* id, std::uint16_t versions) noexcept
+{
+    return (id[8] & 0xC0) == 0x80 && ((versions >> (id[6] >> 4)) & 1) != 0;
+}
+
+#if SIMD_ARCH_X86
+
+// Gathers the leading eight bytes of four consecutive IDs into one register, byte-swapped so
+// every lane holds the big-endian head as an integer: unix_ms = lane >> 16, version =
+// (lane >> 12) & 0xF.
+SIMD_TARGET("avx2") inline __m256i load_heads_avx2(const std::uint8_t* p) noexcept
+{
+    const __m256i bswap64 = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                             7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+    const __m256i heads =
+        _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+    return _mm256_shuffle_epi8(heads, bswap64);
+}
+
+SIMD_TARGET("avx2") inline int v7_lanes_avx2(__m256i heads) noexcept
+{
+    const __m256i version =
+        _mm256_and_si256(_mm256_srli_epi64(heads, 12), _mm256_set1_epi64x(0xF));
+    return _mm256_movemask_pd(
+        _mm256_castsi256_pd(_mm256_cmpeq_epi64(version, _mm256_set1_epi64x(7))));
+}
+
+SIMD_TARGET("avx2")
+inline std::size_t extract_timestamps_avx2(const std::uint8_t* ids, std::size_t n,
+                                           std::uint64_t* out) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m256i heads = load_heads_avx2(ids + 16 * i);
+        if (v7_lanes_avx2(heads) == 0xF)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_srli_epi64(heads, 16));
+        }
+        else
+        {
+            for (std::size_t j = i; j < i + 4; ++j)
+            {
+                out[j] = unix_ms_of(ids + 16 * j);
+            }
+        }
+    }
+    return i;
+}
+
+SIMD_TARGET("avx2")
+inline std::size_t filter_time_range_avx2(const std::uint8_t* ids, std::size_t n,
+                                          std::uint64_t t0, std::uint64_t t1, std::size_t* out,
+                                          std::size_t capacity, std::size_t& written) noexcept
+{
+    // Timestamps are at most 48 bits wide, so clamping the bounds keeps the signed 64-bit
+    // compares exact.
+    constexpr std::uint64_t clamp = std::uint64_t{1} << 62;
+    const __m256i lo = _mm256_set1_epi64x(static_cast<long long>(std::min(t0, clamp)));
+    const __m256i hi = _mm256_set1_epi64x(static_cast<long long>(std::min(t1, clamp)));
+
+    std::size_t i = 0;
+    for (; i + 4 <= n && written + 4 <= capacity; i += 4)
+    {
+        const __m256i heads = load_heads_avx2(ids + 16 * i);
+        const int v7 = v7_lanes_avx2(heads);
+        const __m256i ms = _mm256_srli_epi64(heads, 16);
+        const __m256i in_range =
+            _mm256_andnot_si256(_mm256_cmpgt_epi64(lo, ms), _mm256_cmpgt_epi64(hi, ms));
+
+        unsigned mask = static_cast<unsigned>(
+            _mm256_movemask_pd(_mm256_castsi256_pd(in_range)) & v7);
+        for (unsigned other = static_cast<unsigned>(~v7) & 0xFu; other != 0; other &= other - 1)
+        {
+            const auto lane = static_cast<unsigned>(std::countr_zero(other));
+            const std::uint8_t* id = ids + 16 * (i + lane);
+            const std::uint64_t t = unix_ms_of(id);
+            if (has_timestamp(id) && t >= t0 && t < t1)
+            {
+                mask |= 1u << lane;
+            }
+        }
+
+        for (; mask != 0; mask &= mask - 1)
+        {
+            out[written++] = i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    return i;
+}
+
+// One gather reads bytes 6..9 of eight consecutive IDs into 32-bit lanes: the version is
+// bits 4..7 of each lane and the variant bits 22..23.
+SIMD_TARGET("avx2") inline __m256i version_fields_avx2(const std::uint8_t* p) noexcept
+{
+    const __m256i offsets = _mm256_setr_epi32(6, 22, 38, 54, 70, 86, 102, 118);
+    return _mm256_i32gather_epi32(reinterpret_cast<const int*>(p), offsets, 1);
+}
+
+SIMD_TARGET("avx2") inline __m256i versions_avx2(const std::uint8_t* p) noexcept
+{
+    return _mm256_and_si256(_mm256_srli_epi32(version_fields_avx2(p), 4), _mm256_set1_epi32(0xF));
+}
+
+SIMD_TARGET("avx2")
+inline std::size_t validate_many_avx2(const std::uint8_t* ids, std::size_t n,
+                                      std::uint16_t versions, std::uint64_t* bitmap,
+                                      std::size_t& valid) noexcept
+{
+    const __m256i accepted = _mm256_set1_epi32(versions);
+    const __m256i variant_mask = _mm256_set1_epi32(0x00C00000);
+    const __m256i rfc_variant = _mm256_set1_epi32(0x00800000);
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256i fields = version_fields_avx2(ids + 16 * i);
+        const __m256i version =
+            _mm256_and_si256(_mm256_srli_epi32(fields, 4), _mm256_set1_epi32(0xF));
+        // Moves bit <version> of the accepted set into the sign bit that movemask reads.
+        const __m256i version_ok = _mm256_slli_epi32(_mm256_srlv_epi32(accepted, version), 31);
+        const __m256i variant_ok =
+            _mm256_cmpeq_epi32(_mm256_and_si256(fields, variant_mask), rfc_variant);
+
+        const auto mask = static_cast<unsigned>(
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(version_ok, variant_ok))));
+        bitmap[i / 64] |= std::uint64_t{mask} << (i % 64);
+        valid += static_cast<std::size_t>(std::popcount(mask));
+    }
+    return i;
+}
+
+// Packs the versions of 32 IDs into bytes (in no particular order) and counts them in per-version
+// byte counters, folded into the totals before they can overflow.
+SIMD_TARGET("avx2")
+inline std::size_t version_histogram_avx2(const std::uint8_t* ids, std::size_t n,
+                                          std::array<std::size_t, 16>& counts) noexcept
+{
+    std::size_t i = 0;
+    while (i + 32 <= n)
+    {
+        __m256i lanes[16];
+        std::fill(std::begin(lanes), std::end(lanes), _mm256_setzero_si256());
+
+        const std::size_t rounds = std::min<std::size_t>((n - i) / 32, 255);
+        for (std::size_t r = 0; r < rounds; ++r, i += 32)
+        {
+            const std::uint8_t* p = ids + 16 * i;
+            const __m256i versions = _mm256_packus_epi16(
+                _mm256_packus_epi32(versions_avx2(p), versions_avx2(p + 128)),
+                _mm256_packus_epi32(versions_avx2(p + 256), versions_avx2(p + 384)));
+            for (std::size_t v = 0; v < 16; ++v)
+            {
+                const __m256i hit =
+                    _mm256_cmpeq_epi8(versions, _mm256_set1_epi8(static_cast<char>(v)));
+                lanes[v] = _mm256_sub_epi8(lanes[v], hit);
+            }
+        }
+
+        for (std::size_t v = 0; v < 16; ++v)
+        {
+            const __m256i sums = _mm256_sad_epu8(lanes[v], _mm256_setzero_si256());
+            counts[v] += static_cast<std::size_t>(
+                _mm256_extract_epi64(sums, 0) + _mm256_extract_epi64(sums, 1) +
+                _mm256_extract_epi64(sums, 2) + _mm256_extract_epi64(sums, 3));
+        }
+    }
+    return i;
+}
+
+// hash_uuid_bytes64 on four IDs per register. Unpacking two registers of two IDs each puts the
+// low and the high halves in separate registers, in lane order 0, 2, 1, 3, which the final
+// permute undoes.
+SIMD_TARGET("avx2") inline __m256i hash4_avx2(const std::uint8_t* p, __m256i seed) noexcept
+{
+    const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+    const __m256i h1 = _mm256_xor_si256(_mm256_unpacklo_epi64(a, b), seed);
+    const __m256i h2 = _mm256_unpackhi_epi64(a, b);
+    const __m256i golden = _mm256_set1_epi64x(static_cast<long long>(0x9e3779b97f4a7c15ULL));
+    __m256i mixed = _mm256_add_epi64(h2, golden);
+    mixed = _mm256_add_epi64(mixed, _mm256_slli_epi64(h1, 6));
+    mixed = _mm256_add_epi64(mixed, _mm256_srli_epi64(h1, 2));
+    return _mm256_permute4x64_epi64(_mm256_xor_si256(h1, mixed), 0xD8);
+}
+
+SIMD_TARGET("avx2")
+inline std::size_t hash_many_avx2(const std::uint8_t* ids, std::size_t n, std::uint64_t seed,
+                                  std::uint64_t* out) noexcept
+{
+    const __m256i seeds = _mm256_set1_epi64x(static_cast<long long>(seed));
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256i first = hash4_avx2(ids + 16 * i, seeds);
+        const __m256i second = hash4_avx2(ids + 16 * i + 64, seeds);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), first);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 4), second);
+    }
+    for (; i + 4 <= n; i += 4)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), hash4_avx2(ids + 16 * i, seeds));
+    }
+    return i;
+}
+
+#endif
+
+// ids need not be aligned, so the C API can hash caller buffers in place.
+inline void hash_many_bytes(const std::uint8_t* ids, std::size_t n, std::uint64_t seed,
+                            std::uint64_t* out) noexcept
+{
+    std::size_t i = 0;
+
+#if SIMD_ARCH_X86
+    if (avx2_supported())
+    {
+        i = hash_many_avx2(ids, n, seed, out);
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+        out[i] = hash_uuid_bytes64(ids + 16 * i, seed);
+    }
+}
+
+} // namespace detail
+
+// Bit v of a version set accepts version v.
+[[nodiscard]] constexpr std::uint16_t version_bit(unsigned version) noexcept
+{
+    return static_cast<std::uint16_t>(1u << version);
+}
+
+// Versions 1 through 8, all that RFC 9562 defines.
+inline constexpr std::uint16_t rfc9562_versions = 0x01FE;
+
+// Unix milliseconds of each ID: the 48-bit field of v7, the reassembled 60-bit Gregorian
+// timestamp of v1 and v6; 0 for versions without a timestamp. out must hold ids.size() values.
+inline void extract_timestamps(std::span<const uuid> ids, std::span<std::uint64_t> out) noexcept
+{
+    const std::uint8_t* bytes = detail::column_bytes(ids);
+    const std::size_t n = std::min(ids.size(), out.size());
+    std::size_t i = 0;
+
+#if SIMD_ARCH_X86
+    if (detail::avx2_supported())
+    {
+        i = detail::extract_timestamps_avx2(bytes, n, out.data());
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+        out[i] = detail::unix_ms_of(bytes + 16 * i);
+    }
+}
+
+// Writes the index of every ID whose timestamp lies in [t0_ms, t1_ms) to out, in column order,
+// and returns how many were written; stops early once out is full. IDs without a timestamp
+// (versions other than 1, 6 and 7) never match, even when t0_ms is 0.
+[[nodiscard]] inline std::size_t filter_time_range(std::span<const uuid> ids, std::uint64_t t0_ms,
+                                                   std::uint64_t t1_ms,
+                                                   std::span<std::size_t> out) noexcept
+{
+    const std::uint8_t* bytes = detail::column_bytes(ids);
+    std::size_t written = 0;
+    std::size_t i = 0;
+
+#if SIMD_ARCH_X86
+    if (detail::avx2_supported())
+    {
+        i = detail::filter_time_range_avx2(bytes, ids.size(), t0_ms, t1_ms, out.data(),
+                                           out.size(), written);
+    }
+#endif
+
+    for (; i < ids.size() && written < out.size(); ++i)
+    {
+        const std::uint8_t* id = bytes + 16 * i;
+        const std::uint64_t t = detail::unix_ms_of(id);
+        if (detail::has_timestamp(id) && t >= t0_ms && t < t1_ms)
+        {
+            out[written++] = i;
+        }
+    }
+    return written;
+}
+
+// Sets bit i of out_bitmap (64 IDs per word, least significant bit first) iff ids[i] carries the
+// RFC 9562 variant and a version in expected_versions, and clears it otherwise. Nil and max
+// always fail, their variant fields being 0b00 and 0b11. Covers as many IDs as the bitmap has
+// bits and returns how many of them are valid.
+inline std::size_t validate_many(std::span<const uuid> ids, std::uint16_t expected_versions,
+                                 std::span<std::uint64_t> out_bitmap) noexcept
+{
+    const std::uint8_t* bytes = detail::column_bytes(ids);
+    const std::size_t n = std::min(ids.size(), out_bitmap.size() * 64);
+    std::fill_n(out_bitmap.begin(), (n + 63) / 64, std::uint64_t{0});
+
+    std::size_t valid = 0;
+    std::size_t i = 0;
+
+#if SIMD_ARCH_X86
+    if (detail::avx2_supported())
+    {
+        i = detail::validate_many_avx2(bytes, n, expected_versions, out_bitmap.data(), valid);
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+        if (detail::valid_id(bytes + 16 * i, expected_versions))
+        {
+            out_bitmap[i / 64] |= std::uint64_t{1} << (i % 64);
+            ++valid;
+        }
+    }
+    return valid;
+}
+
+// Number of IDs with each version nibble, whatever their variant.
+[[nodiscard]] inline std::array<std::size_t, 16>
+version_histogram(std::span<const uuid> ids) noexcept
+{
+    const std::uint8_t* bytes = detail::column_bytes(ids);
+    std::array<std::size_t, 16> counts{};
+    std::size_t i = 0;
+
+#if SIMD_ARCH_X86
+    if (detail::avx2_supported())
+    {
+        i = detail::version_histogram_avx2(bytes, ids.size(), counts);
+    }
+#endif
+
+    for (; i < ids.size(); ++i)
+    {
+        ++counts[bytes[16 * i + 6] >> 4];
+    }
+    return counts;
+}
+
+// hash_value(ids[i], seed) of each ID, four at a time with AVX2; seed 0 matches std::hash<uuid>
+// on 64-bit targets. out must hold ids.size() values.
+inline void hash_many(std::span<const uuid> ids, std::span<std::uint64_t> out,
+                      std::uint64_t seed = 0) noexcept
+{
+    detail::hash_many_bytes(detail::column_bytes(ids), std::min(ids.size(), out.size()), seed,
+                            out.data());
+}
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: BULK_HPP_n2j7xc */
@@ -0,0 +1,392 @@
+#ifndef CLOCK_HPP_f6v2pe
+#define CLOCK_HPP_f6v2pe
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <thread>
+
+#include <simd/common.hpp>
+#include <uuids/entropy.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+#endif
+
+namespace uuids::inline v1
+{
+
+template <typename C>
+concept ClockSource = requires {
+    { C::unix_ms() } -> std::same_as<std::uint64_t>;
+};
+
+namespace detail
+{
+
+[[nodiscard]] inline std::uint64_t system_unix_ns() noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+    timespec ts{};
+    ::clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<std::uint64_t>(ts.tv_sec) * 1'000'000'000u +
+           static_cast<std::uint64_t>(ts.tv_nsec);
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::system_clock::now().time_since_epoch())
+                                          .count());
+#endif
+}
+
+// A clock no one can step or slew, for measuring rates: CLOCK_MONOTONIC_RAW on Linux.
+[[nodiscard]] inline std::uint64_t raw_monotonic_ns() noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+    timespec ts{};
+#if defined(CLOCK_MONOTONIC_RAW)
+    ::clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+#else
+    ::clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return static_cast<std::uint64_t>(ts.tv_sec) * 1'000'000'000u +
+           static_cast<std::uint64_t>(ts.tv_nsec);
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::steady_clock::now().time_since_epoch())
+                                          .count());
+#endif
+}
+
+[[nodiscard]] inline std::uint64_t system_unix_ms() noexcept
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                          std::chrono::system_clock::now().time_since_epoch())
+                                          .count());
+}
+
+} // namespace detail
+
+struct system_clock_source final
+{
+    [[nodiscard]] static std::uint64_t unix_ms() noexcept { return detail::system_unix_ms(); }
+};
+
+// CLOCK_REALTIME_COARSE is a plain vDSO memory read without a hardware counter access; its
+// resolution is the kernel tick (1-4 ms). Other platforms use the regular system clock.
+struct coarse_clock_source final
+{
+    [[nodiscard]] static std::uint64_t unix_ms() noexcept
+    {
+#if defined(__linux__)
+        timespec ts{};
+        ::clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+        return static_cast<std::uint64_t>(ts.tv_sec) * 1000u +
+               static_cast<std::uint64_t>(ts.tv_nsec) / 1'000'000u;
+#else
+        return detail::system_unix_ms();
+#endif
+    }
+};
+
+namespace detail
+{
+
+[[nodiscard]] inline bool invariant_tsc_supported() noexcept
+{
+#if SIMD_ARCH_X86 && (SIMD_COMPILER_GCC || SIMD_COMPILER_CLANG)
+    unsigned eax = 0;
+    unsigned ebx = 0;
+    unsigned ecx = 0;
+    unsigned edx = 0;
+    if (__get_cpuid(0x80000000u, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007u)
+    {
+        return false;
+    }
+    __get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx);
+    return (edx & (1u << 8)) != 0;
+#elif SIMD_ARCH_X86 && SIMD_COMPILER_MSVC
+    int regs[4]{};
+    __cpuid(regs, static_cast<int>(0x80000000u));
+    if (static_cast<unsigned>(regs[0]) < 0x80000007u)
+    {
+        return false;
+    }
+    __cpuid(regs, static_cast<int>(0x80000007u));
+    return (static_cast<unsigned>(regs[3]) & (1u << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+[[nodiscard]] inline std::uint64_t read_tsc() noexcept
+{
+#if SIMD_ARCH_X86 && (SIMD_COMPILER_GCC || SIMD_COMPILER_CLANG || SIMD_COMPILER_MSVC)
+    return static_cast<std::uint64_t>(__rdtsc());
+#else
+    return 0;
+#endif
+}
+
+// One reading of the raw monotonic and the wall clock, timed by the TSC reads around it.
+struct clock_sample final
+{
+    std::uint64_t tsc;
+    std::uint64_t raw_ns;
+    std::uint64_t wall_ns;
+};
+
+// The narrowest of a few bracketed readings, stamped with the midpoint of its TSC window, so a
+// thread preempted between two reads cannot pair one clock's time with another's much later.
+[[nodiscard]] inline clock_sample take_clock_sample() noexcept
+{
+    clock_sample best{};
+    std::uint64_t best_window = ~std::uint64_t{0};
+    for (int attempt = 0; attempt < 8; ++attempt)
+    {
+        const std::uint64_t before = read_tsc();
+        const std::uint64_t raw = raw_monotonic_ns();
+        const std::uint64_t wall = system_unix_ns();
+        const std::uint64_t after = read_tsc();
+        const std::uint64_t window = after - before;
+        if (window < best_window)
+        {
+            best_window = window;
+            best = clock_sample{before + window / 2, raw, wall};
+        }
+    }
+    return best;
+}
+
+// Converts TSC readings to wall time with an anchor (tsc, ns) and a 32.32 fixed-point ns-per-tick
+// rate. The rate is first measured over a short spin and refined at every resync over the whole
+// interval since the previous anchor, both times against the raw monotonic clock, so a step of
+// the wall clock can never skew it. The anchor's wall time comes from the same paired sample, so
+// NTP slews and forward steps are picked up within one resync period. The clock never runs
+// backwards: when the wall clock is behind the running projection, the anchor stays on the
+// projection and the rate is slowed by at most max_slew_ppm until the wall clock catches up.
+// Readers use a seqlock. The one caller that resyncs takes its sample before it makes the
+// sequence odd, so readers only ever retry across the four stores that publish the anchor.
+class tsc_calibration final
+{
+public:
+    static constexpr std::uint64_t resync_period_ns = 1'000'000'000;
+    static constexpr std::uint64_t max_slew_ppm = 500;
+
+    [[nodiscard]] static tsc_calibration& instance() noexcept
+    {
+        static tsc_calibration calibration;
+        return calibration;
+    }
+
+    [[nodiscard]] bool usable() const noexcept { return usable_; }
+
+    [[nodiscard]] std::uint64_t unix_ns() noexcept
+    {
+        const std::uint64_t tsc = read_tsc();
+
+        for (;;)
+        {
+            const std::uint64_t seq = seq_.load(std::memory_order_acquire);
+            if ((seq & 1) != 0)
+            {
+                continue;
+            }
+
+            const std::uint64_t base_tsc = base_tsc_.load(std::memory_order_relaxed);
+            const std::uint64_t base_ns = base_ns_.load(std::memory_order_relaxed);
+            const std::uint64_t rate = ns_per_tick_q32_.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq_.load(std::memory_order_relaxed) != seq)
+            {
+                continue;
+            }
+
+            const std::uint64_t elapsed = tsc > base_tsc ? tsc - base_tsc : 0;
+            const std::uint64_t elapsed_ns = scale(elapsed, rate);
+            if (elapsed_ns >= resync_period_ns)
+            {
+                resync(seq, base_tsc, base_ns, rate);
+            }
+            return base_ns + elapsed_ns;
+        }
+    }
+
+private:
+    tsc_calibration() noexcept : usable_{invariant_tsc_supported()}
+    {
+        if (!usable_)
+        {
+            return;
+        }
+
+        const clock_sample first = take_clock_sample();
+        while (raw_monotonic_ns() - first.raw_ns < 2'000'000)
+        {
+        }
+        const clock_sample last = take_clock_sample();
+
+        base_tsc_.store(last.tsc, std::memory_order_relaxed);
+        base_ns_.store(last.wall_ns, std::memory_order_relaxed);
+        base_raw_ns_ = last.raw_ns;
+        ns_per_tick_q32_.store(rate_of(last.tsc - first.tsc, last.raw_ns - first.raw_ns),
+                               std::memory_order_release);
+    }
+
+    [[nodiscard]] static std::uint64_t scale(std::uint64_t ticks, std::uint64_t rate) noexcept
+    {
+        return ((ticks >> 32) * rate) + (((ticks & 0xFFFFFFFFu) * rate) >> 32);
+    }
+
+    [[nodiscard]] static std::uint64_t rate_of(std::uint64_t ticks, std::uint64_t ns) noexcept
+    {
+        if (ticks == 0)
+        {
+            return std::uint64_t{1} << 32;
+        }
+        return static_cast<std::uint64_t>((static_cast<double>(ns) / static_cast<double>(ticks)) *
+                                          4294967296.0);
+    }
+
+    // base_tsc, base_ns and rate are the anchor the caller read under seq.
+    void resync(std::uint64_t seq, std::uint64_t base_tsc, std::uint64_t base_ns,
+                std::uint64_t rate) noexcept
+    {
+        if (resyncing_.exchange(true, std::memory_order_acquire))
+        {
+            return;
+        }
+        if (seq_.load(std::memory_order_relaxed) != seq)
+        {
+            resyncing_.store(false, std::memory_order_release);
+            return;
+        }
+
+        // Where readers of the current anchor have got to, at the sample's TSC.
+        const clock_sample sample = take_clock_sample();
+        const std::uint64_t projected =
+            base_ns + scale(sample.tsc > base_tsc ? sample.tsc - base_tsc : 0, rate);
+        if (sample.tsc > base_tsc && sample.raw_ns > base_raw_ns_)
+        {
+            rate = rate_of(sample.tsc - base_tsc, sample.raw_ns - base_raw_ns_);
+        }
+
+        std::uint64_t anchor_ns = sample.wall_ns;
+        if (projected > sample.wall_ns)
+        {
+            // Hold the projection and run slow until the wall clock has caught up.
+            const std::uint64_t lag = projected - sample.wall_ns;
+            const std::uint64_t slew = std::min(lag, resync_period_ns / 1'000'000 * max_slew_ppm);
+            anchor_ns = projected;
+            rate -= rate * slew / resync_period_ns;
+        }
+
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        base_tsc_.store(sample.tsc, std::memory_order_relaxed);
+        base_ns_.store(anchor_ns, std::memory_order_relaxed);
+        ns_per_tick_q32_.store(rate, std::memory_order_relaxed);
+        base_raw_ns_ = sample.raw_ns;
+        seq_.store(seq + 2, std::memory_order_release);
+
+        resyncing_.store(false, std::memory_order_release);
+    }
+
+    bool usable_;
+    std::atomic<std::uint64_t> seq_{0};
+    std::atomic<std::uint64_t> base_tsc_{0};
+    std::atomic<std::uint64_t> base_ns_{0};
+    std::atomic<std::uint64_t> ns_per_tick_q32_{std::uint64_t{1} << 32};
+    std::atomic<bool> resyncing_{false};
+    // Only touched by the constructor and by the caller holding resyncing_.
+    std::uint64_t base_raw_ns_{0};
+};
+
+// Published by a detached ticker thread. The state is intentionally leaked so the ticker never
+// touches a destroyed object during static destruction. The child of a fork() has no copy of the
+// ticker, so its first read starts a fresh one; a fork handler could not, since creating a
+// thread there is not async-signal-safe.
+class cached_clock_state final
+{
+public:
+    static constexpr std::chrono::microseconds tick_period{500};
+
+    [[nodiscard]] static cached_clock_state& instance() noexcept
+    {
+        static cached_clock_state* state = new cached_clock_state();
+        return *state;
+    }
+
+    [[nodiscard]] std::uint64_t unix_ms() noexcept
+    {
+        std::uint64_t seen = generation_.load(std::memory_order_relaxed);
+        const std::uint64_t current = fork_generation();
+        if (seen != current && generation_.compare_exchange_strong(seen, current))
+        {
+            start();
+        }
+        return now_ms_.load(std::memory_order_relaxed);
+    }
+
+private:
+    cached_clock_state() noexcept
+    {
+        now_ms_.store(system_unix_ms(), std::memory_order_relaxed);
+        start();
+    }
+
+    void start() noexcept
+    {
+        now_ms_.store(system_unix_ms(), std::memory_order_relaxed);
+        try
+        {
+            std::thread(
+                [this]()
+                {
+                    for (;;)
+                    {
+                        now_ms_.store(system_unix_ms(), std::memory_order_relaxed);
+                        std::this_thread::sleep_for(tick_period);
+                    }
+                })
+                .detach();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    std::atomic<std::uint64_t> now_ms_{0};
+    std::atomic<std::uint64_t> generation_{fork_generation()};
+};
+
+} // namespace detail
+
+// Invariant-TSC clock: one rdtsc plus a fixed-point multiply per read. Falls back to the coarse
+// clock where the TSC is not invariant (or on non-x86 targets).
+struct tsc_clock_source final
+{
+    [[nodiscard]] static std::uint64_t unix_ms() noexcept
+    {
+        auto& calibration = detail::tsc_calibration::instance();
+        if (!calibration.usable())
+        {
+            return coarse_clock_source::unix_ms();
+        }
+        return calibration.unix_ns() / 1'000'000u;
+    }
+};
+
+// A single relaxed load of a value refreshed by a background thread every 500 us.
+struct cached_clock_source final
+{
+    [[nodiscard]] static std::uint64_t unix_ms() noexcept
+    {
+        return detail::cached_clock_state::instance().unix_ms();
+    }
+};
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: CLOCK_HPP_f6v2pe */
@@ -0,0 +1,347 @@
+#ifndef ENTROPY_HPP_g2s8uf
+#define ENTROPY_HPP_g2s8uf
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <span>
+#include <type_traits>
+
+#include <uuids/probes.hpp>
+
+#if defined(__linux__)
+#include <sys/random.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace uuids::inline v1
+{
+
+using seed256 = std::array<std::uint64_t, 4>;
+
+namespace detail
+{
+
+[[nodiscard]] constexpr std::uint64_t splitmix64(std::uint64_t& state) noexcept
+{
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// getrandom() where available; std::random_device otherwise, or if the syscall fails. Returns
+// false only if both sources failed.
+inline bool fill_os_entropy(std::span<std::byte> out) noexcept
+{
+#if defined(__linux__)
+    while (!out.empty())
+    {
+        const ssize_t n = ::getrandom(out.data(), out.size(), 0);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        out = out.subspan(static_cast<std::size_t>(n));
+    }
+#endif
+
+    if (out.empty())
+    {
+        return true;
+    }
+
+    try
+    {
+        std::random_device device;
+        while (!out.empty())
+        {
+            const std::random_device::result_type word = device();
+            const std::size_t n = std::min(out.size(), sizeof(word));
+            std::memcpy(out.data(), &word, n);
+            out = out.subspan(n);
+        }
+        return true;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+// Where the pool and the buffers read the kernel; tests replace it to exercise failures.
+inline bool (*os_entropy_source)(std::span<std::byte>) noexcept = fill_os_entropy;
+
+// Counts forks, as seen from the child; state captured before a fork compares unequal after it.
+[[nodiscard]] inline std::uint64_t fork_generation() noexcept
+{
+    static std::atomic<std::uint64_t> generation{0};
+#if defined(__unix__) || defined(__APPLE__)
+    static const bool registered = []()
+    {
+        ::pthread_atfork(nullptr, nullptr,
+                         []() { generation.fetch_add(1, std::memory_order_relaxed); });
+        return true;
+    }();
+    static_cast<void>(registered);
+#endif
+    return generation.load(std::memory_order_relaxed);
+}
+
+// Kernel randomness read 64 KiB at a time (4096 v4 IDs per getrandom()). Each word is wiped as
+// it is handed out and the unread rest when the thread exits, so a later memory disclosure
+// cannot replay IDs already issued. A buffer filled before a fork is discarded in the child.
+class os_entropy_buffer final
+{
+public:
+    static constexpr std::size_t words = 64 * 1024 / sizeof(std::uint64_t);
+
+    os_entropy_buffer() noexcept = default;
+    os_entropy_buffer(const os_entropy_buffer&) = delete;
+    os_entropy_buffer& operator=(const os_entropy_buffer&) = delete;
+
+    ~os_entropy_buffer() { wipe(std::span(data_).subspan(next_)); }
+
+    [[nodiscard]] std::uint64_t take() noexcept
+    {
+        if (next_ == words || generation_ != fork_generation())
+        {
+            if (next_ != words)
+            {
+                UUIDS_PROBE(fork_reseed);
+            }
+            refill();
+        }
+        const std::uint64_t word = data_[next_];
+        data_[next_++] = 0;
+        return word;
+    }
+
+    [[nodiscard]] std::span<const std::uint64_t, words> data() const noexcept { return data_; }
+
+    [[nodiscard]] std::size_t position() const noexcept { return next_; }
+
+private:
+    static void wipe(std::span<std::uint64_t> words_left) noexcept
+    {
+        volatile std::uint64_t* p = words_left.data();
+        for (std::size_t i = 0; i < words_left.size(); ++i)
+        {
+            p[i] = 0;
+        }
+    }
+
+    void refill() noexcept
+    {
+        generation_ = fork_generation();
+        UUIDS_PROBE1(pool_refill_start, sizeof(data_));
+        const bool filled = os_entropy_source(std::as_writable_bytes(std::span(data_)));
+        UUIDS_PROBE2(pool_refill_end, sizeof(data_), filled ? 1 : 0);
+        if (!filled)
+        {
+            // Handing out predictable words would be worse than stopping.
+            std::abort();
+        }
+        next_ = 0;
+    }
+
+    std::array<std::uint64_t, words> data_{};
+    std::size_t next_{words};
+    std::uint64_t generation_{0};
+};
+
+// Allocated on first use, so threads that never draw from it pay nothing for it.
+[[nodiscard]] inline os_entropy_buffer& local_os_entropy()
+{
+    thread_local std::unique_ptr<os_entropy_buffer> buffer;
+    if (buffer == nullptr)
+    {
+        buffer = std::make_unique<os_entropy_buffer>();
+    }
+    return *buffer;
+}
+
+// One OS read fills 4 KiB, enough for 128 seeds; a ticket from a single fetch_add selects the
+// block. Every seed is mixed with its ticket, so callers that race with a refill (and read
+// either the old or the new block) still never receive the same seed. The pool is leaked so
+// generators built during static destruction keep working, and a fork handler refills it in the
+// child so parent and child do not hand out the same seeds.
+class entropy_pool final
+{
+public:
+    static constexpr std::size_t pool_words = 512;
+    static constexpr std::size_t seeds_per_fill = pool_words / std::tuple_size_v<seed256>;
+
+    [[nodiscard]] static entropy_pool& instance() noexcept
+    {
+        static entropy_pool* pool = new entropy_pool();
+        return *pool;
+    }
+
+    [[nodiscard]] seed256 take() noexcept
+    {
+        const std::uint64_t ticket = cursor_.fetch_add(1, std::memory_order_relaxed);
+        const std::size_t slot = ticket % seeds_per_fill;
+        if (slot == 0 && ticket != 0)
+        {
+            refill();
+        }
+
+        seed256 seed;
+        std::uint64_t state = ticket * 0x9E3779B97F4A7C15ULL;
+        for (std::size_t i = 0; i < seed.size(); ++i)
+        {
+            state ^= words_[slot * seed.size() + i].load(std::memory_order_relaxed);
+            seed[i] = splitmix64(state);
+        }
+        return seed;
+    }
+
+private:
+    entropy_pool() noexcept
+    {
+        refill();
+#if defined(__unix__) || defined(__APPLE__)
+        ::pthread_atfork(nullptr, nullptr,
+                         []()
+                         {
+                             UUIDS_PROBE(fork_reseed);
+                             instance().refill();
+                         });
+#endif
+    }
+
+    void refill() noexcept
+    {
+        std::array<std::uint64_t, pool_words> fresh{};
+        UUIDS_PROBE1(pool_refill_start, sizeof(fresh));
+        const bool filled = os_entropy_source(std::as_writable_bytes(std::span(fresh)));
+        UUIDS_PROBE2(pool_refill_end, sizeof(fresh), filled ? 1 : 0);
+        if (!filled)
+        {
+            // Seeds from the ticket alone would repeat in every process; stop, as the buffers do.
+            std::abort();
+        }
+        for (std::size_t i = 0; i < pool_words; ++i)
+        {
+            words_[i].store(fresh[i], std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<std::uint64_t> cursor_{0};
+    std::array<std::atomic<std::uint64_t>, pool_words> words_{};
+};
+
+// Expands 256 bits into as many 32-bit words as an engine asks for, from four interleaved
+// splitmix64 streams, one per seed word.
+class splitmix_seed_seq final
+{
+public:
+    using result_type = std::uint32_t;
+
+    explicit constexpr splitmix_seed_seq(const seed256& seed) noexcept : seed_{seed} {}
+
+    template <typename It>
+    constexpr void generate(It first, It last) const noexcept
+    {
+        seed256 streams = seed_;
+        for (std::size_t i = 0; first != last; ++i)
+        {
+            const std::uint64_t word = splitmix64(streams[i % streams.size()]);
+            *first++ = static_cast<result_type>(word);
+            if (first != last)
+            {
+                *first++ = static_cast<result_type>(word >> 32);
+            }
+        }
+    }
+
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return 0; }
+
+    template <typename It>
+    constexpr void param(It) const noexcept
+    {
+    }
+
+private:
+    seed256 seed_;
+};
+
+} // namespace detail
+
+[[nodiscard]] inline seed256 fresh_seed() noexcept
+{
+    return detail::entropy_pool::instance().take();
+}
+
+// Engines with a seed-sequence constructor (all standard engines) get their whole state from the
+// 256-bit seed; others are seeded with one derived word.
+template <typename Engine>
+[[nodiscard]] Engine seeded_engine(const seed256& seed)
+{
+    detail::splitmix_seed_seq sequence(seed);
+    if constexpr (std::is_constructible_v<Engine, detail::splitmix_seed_seq&>)
+    {
+        return Engine(sequence);
+    }
+    else
+    {
+        std::uint64_t state = seed[0] ^ seed[1] ^ seed[2] ^ seed[3];
+        return Engine(static_cast<typename Engine::result_type>(detail::splitmix64(state)));
+    }
+}
+
+template <typename Engine>
+[[nodiscard]] Engine seeded_engine()
+{
+    return seeded_engine<Engine>(fresh_seed());
+}
+
+// A random bit engine over the kernel CSPRNG for hosts without RDRAND, where a seeded mt19937_64
+// is not acceptable for security-sensitive IDs. All engines of a thread share one buffer.
+// Seeds are accepted for drop-in use and ignored: the output is never reproducible.
+class os_entropy_engine final
+{
+public:
+    using result_type = std::uint64_t;
+
+    constexpr os_entropy_engine() noexcept = default;
+
+    explicit constexpr os_entropy_engine(result_type) noexcept {}
+
+    [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+
+    [[nodiscard]] static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() noexcept { return detail::local_os_entropy().take(); }
+
+    void discard(unsigned long long n) noexcept
+    {
+        for (; n > 0; --n)
+        {
+            static_cast<void>((*this)());
+        }
+    }
+};
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: ENTROPY_HPP_g2s8uf */
@@ -0,0 +1,819 @@
+#ifndef FILE_SINK_HPP_e4j7rb
+#define FILE_SINK_HPP_e4j7rb
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "uuids/file_sink.hpp requires POSIX file I/O"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define UUIDS_HAS_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#else
+#define UUIDS_HAS_IO_URING 0
+#endif
+
+#include <uuids/uuid.hpp>
+
+namespace uuids::inline v1
+{
+
+struct file_sink_options final
+{
+    // Rounded up to a multiple of 4096, as O_DIRECT requires.
+    std::size_t buffer_size = 1 << 20;
+    std::size_t buffer_count = 3;
+    // O_DIRECT, for files opened by the sink.
+    bool direct = false;
+    // false forces the pwrite thread even where io_uring is available.
+    bool io_uring = true;
+};
+
+namespace detail
+{
+
+inline constexpr std::size_t sink_alignment = 4096;
+
+[[noreturn]] inline void throw_sink_error(int error, const char* what)
+{
+    throw std::system_error(error, std::generic_category(), what);
+}
+
+// A finished write: the buffer is free again whether or not it reached the file.
+struct sink_completion final
+{
+    std::size_t index;
+    int error;
+    const char* what;
+};
+
+#if UUIDS_HAS_IO_URING
+
+// The few io_uring operations the sink needs, on raw system calls so that no liburing is
+// required. The ring has one entry per buffer and a buffer is in flight at most once, so the
+// submission queue can never overflow.
+class uring_writer final
+{
+public:
+    uring_writer(int fd, std::byte* buffers, std::size_t buffer_size, std::size_t buffer_count)
+        : fd_{fd}, buffers_{buffers}, buffer_size_{buffer_size}, pending_(buffer_count)
+    {
+        io_uring_params params{};
+        const long ring = ::syscall(__NR_io_uring_setup, static_cast<unsigned>(buffer_count),
+                                    &params);
+        if (ring < 0)
+        {
+            throw_sink_error(errno, "io_uring_setup");
+        }
+        ring_fd_ = static_cast<int>(ring);
+
+        try
+        {
+            // IORING_OP_WRITE arrived together with this feature bit (Linux 5.6).
+            if ((params.features & IORING_FEAT_RW_CUR_POS) == 0)
+            {
+                throw_sink_error(ENOSYS, "io_uring write");
+            }
+            map_rings(params);
+        }
+        catch (...)
+        {
+            unmap();
+            throw;
+        }
+
+        // Fixed buffers skip the per-write page pinning; without enough RLIMIT_MEMLOCK plain
+        // writes from the same memory work too.
+        std::vector<iovec> iovecs(buffer_count);
+        for (std::size_t i = 0; i < buffer_count; ++i)
+        {
+            iovecs[i] = iovec{buffers_ + i * buffer_size_, buffer_size_};
+        }
+        fixed_ = ::syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_BUFFERS,
+                           iovecs.data(), static_cast<unsigned>(buffer_count)) == 0;
+    }
+
+    uring_writer(const uring_writer&) = delete;
+    uring_writer& operator=(const uring_writer&) = delete;
+
+    // The kernel may still be reading a buffer, so every write is waited for before the memory
+    // can be released.
+    ~uring_writer()
+    {
+        while (in_flight_ > 0)
+        {
+            try
+            {
+                static_cast<void>(reap());
+            }
+            catch (...)
+            {
+            }
+        }
+        unmap();
+    }
+
+    void submit(std::size_t index, std::size_t size, std::uint64_t offset)
+    {
+        pending_[index] = pending_write{size, 0, offset};
+        push(index);
+        ++in_flight_;
+    }
+
+    // Blocks until a buffer's write has completed in full, or failed.
+    [[nodiscard]] sink_completion reap()
+    {
+        for (;;)
+        {
+            const std::uint32_t head = *cq_head_;
+            if (head == std::atomic_ref<std::uint32_t>(*cq_tail_).load(std::memory_order_acquire))
+            {
+                enter(0, 1, IORING_ENTER_GETEVENTS);
+                continue;
+            }
+
+            const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+            const std::size_t index = cqe.user_data;
+            const std::int32_t result = cqe.res;
+            std::atomic_ref<std::uint32_t>(*cq_head_).store(head + 1, std::memory_order_release);
+
+            pending_write& pending = pending_[index];
+            if (result == -EINTR || result == -EAGAIN)
+            {
+                push(index);
+                continue;
+            }
+            if (result <= 0)
+            {
+                --in_flight_;
+                return sink_completion{index, result < 0 ? -result : EIO, "io_uring write"};
+            }
+
+            pending.done += static_cast<std::size_t>(result);
+            if (pending.done < pending.size)
+            {
+                push(index);
+                continue;
+            }
+            --in_flight_;
+            return sink_completion{index, 0, nullptr};
+        }
+    }
+
+private:
+    struct pending_write final
+    {
+        std::size_t size;
+        std::size_t done;
+        std::uint64_t offset;
+    };
+
+    void map_rings(const io_uring_params& params)
+    {
+        sq_bytes_ = params.sq_off.array + params.sq_entries * sizeof(std::uint32_t);
+        cq_bytes_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap)
+        {
+            sq_bytes_ = cq_bytes_ = std::max(sq_bytes_, cq_bytes_);
+        }
+
+        sq_ring_ = map(sq_bytes_, IORING_OFF_SQ_RING);
+        cq_ring_ = single_mmap ? sq_ring_ : map(cq_bytes_, IORING_OFF_CQ_RING);
+        sqes_bytes_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(map(sqes_bytes_, IORING_OFF_SQES));
+
+        auto* sq = static_cast<std::byte*>(sq_ring_);
+        auto* cq = static_cast<std::byte*>(cq_ring_);
+        sq_tail_ = reinterpret_cast<std::uint32_t*>(sq + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<std::uint32_t*>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<std::uint32_t*>(sq + params.sq_off.array);
+        cq_head_ = reinterpret_cast<std::uint32_t*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<std::uint32_t*>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<std::uint32_t*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    }
+
+    [[nodiscard]] void* map(std::size_t bytes, std::uint64_t offset) const
+    {
+        void* memory = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                              ring_fd_, static_cast<off_t>(offset));
+        if (memory == MAP_FAILED)
+        {
+            throw_sink_error(errno, "mmap io_uring");
+        }
+        return memory;
+    }
+
+    void unmap() noexcept
+    {
+        if (sqes_ != nullptr)
+        {
+            ::munmap(sqes_, sqes_bytes_);
+        }
+        if (cq_ring_ != nullptr && cq_ring_ != sq_ring_)
+        {
+            ::munmap(cq_ring_, cq_bytes_);
+        }
+        if (sq_ring_ != nullptr)
+        {
+            ::munmap(sq_ring_, sq_bytes_);
+        }
+        ::close(ring_fd_);
+    }
+
+    // Queues the unwritten remainder of a buffer.
+    void push(std::size_t index)
+    {
+        const pending_write& pending = pending_[index];
+        const std::uint32_t tail = *sq_tail_;
+        const std::uint32_t slot = tail & sq_mask_;
+
+        io_uring_sqe& sqe = sqes_[slot];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = fixed_ ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+        sqe.fd = fd_;
+        sqe.addr = reinterpret_cast<std::uint64_t>(buffers_ + index * buffer_size_ + pending.done);
+        sqe.len = static_cast<std::uint32_t>(pending.size - pending.done);
+        sqe.off = pending.offset + pending.done;
+        sqe.buf_index = static_cast<std::uint16_t>(index);
+        sqe.user_data = index;
+
+        sq_array_[slot] = slot;
+        std::atomic_ref<std::uint32_t>(*sq_tail_).store(tail + 1, std::memory_order_release);
+        enter(1, 0, 0);
+    }
+
+    void enter(unsigned submit, unsigned wait, unsigned flags)
+    {
+        while (::syscall(__NR_io_uring_enter, ring_fd_, submit, wait, flags, nullptr, 0) < 0)
+        {
+            if (errno != EINTR && errno != EAGAIN)
+            {
+                throw_sink_error(errno, "io_uring_enter");
+            }
+        }
+    }
+
+    int fd_;
+    int ring_fd_{-1};
+    std::byte* buffers_;
+    std::size_t buffer_size_;
+    std::vector<pending_write> pending_;
+    std::size_t in_flight_{0};
+    bool fixed_{false};
+
+    void* sq_ring_{nullptr};
+    void* cq_ring_{nullptr};
+    io_uring_sqe* sqes_{nullptr};
+    std::size_t sq_bytes_{0};
+    std::size_t cq_bytes_{0};
+    std::size_t sqes_bytes_{0};
+    std::uint32_t* sq_tail_{nullptr};
+    std::uint32_t* sq_array_{nullptr};
+    std::uint32_t sq_mask_{0};
+    std::uint32_t* cq_head_{nullptr};
+    std::uint32_t* cq_tail_{nullptr};
+    std::uint32_t cq_mask_{0};
+    io_uring_cqe* cqes_{nullptr};
+};
+
+#endif
+
+// The fallback: one thread writes queued buffers in order with pwrite (write for pipes and
+// other unseekable files), so the producer still never waits on the device while a buffer is
+// free.
+class thread_writer final
+{
+public:
+    thread_writer(int fd, std::byte* buffers, std::size_t buffer_size, bool seekable)
+        : fd_{fd}, buffers_{buffers}, buffer_size_{buffer_size}, seekable_{seekable},
+          thread_{[this]() { run(); }}
+    {
+    }
+
+    thread_writer(const thread_writer&) = delete;
+    thread_writer& operator=(const thread_writer&) = delete;
+
+    ~thread_writer()
+    {
+        {
+            std::lock_guard lock(mutex_);
+            stop_ = true;
+        }
+        work_ready_.notify_one();
+        thread_.join();
+    }
+
+    void submit(std::size_t index, std::size_t size, std::uint64_t offset)
+    {
+        {
+            std::lock_guard lock(mutex_);
+            queue_.push_back(job{index, size, offset});
+        }
+        work_ready_.notify_one();
+    }
+
+    [[nodiscard]] sink_completion reap()
+    {
+        std::unique_lock lock(mutex_);
+        done_ready_.wait(lock, [this]() { return !done_.empty(); });
+        const sink_completion done = done_.front();
+        done_.pop_front();
+        return done;
+    }
+
+private:
+    struct job final
+    {
+        std::size_t index;
+        std::size_t size;
+        std::uint64_t offset;
+    };
+
+    void run()
+    {
+        std::unique_lock lock(mutex_);
+        for (;;)
+        {
+            work_ready_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+            if (queue_.empty())
+            {
+                return;
+            }
+            const job next = queue_.front();
+            queue_.pop_front();
+            lock.unlock();
+
+            const int error = write_all(next);
+
+            lock.lock();
+            done_.push_back(sink_completion{next.index, error, seekable_ ? "pwrite" : "write"});
+            done_ready_.notify_one();
+        }
+    }
+
+    [[nodiscard]] int write_all(const job& next) const noexcept
+    {
+        const std::byte* data = buffers_ + next.index * buffer_size_;
+        std::size_t done = 0;
+        while (done < next.size)
+        {
+            const ssize_t n =
+                seekable_ ? ::pwrite(fd_, data + done, next.size - done,
+                                     static_cast<off_t>(next.offset + done))
+                          : ::write(fd_, data + done, next.size - done);
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (n <= 0)
+            {
+                return n < 0 ? errno : EIO;
+            }
+            done += static_cast<std::size_t>(n);
+        }
+        return 0;
+    }
+
+    int fd_;
+    std::byte* buffers_;
+    std::size_t buffer_size_;
+    bool seekable_;
+
+    std::mutex mutex_;
+    std::condition_variable work_ready_;
+    std::condition_variable done_ready_;
+    std::deque<job> queue_;
+    std::deque<sink_completion> done_;
+    bool stop_{false};
+    std::thread thread_;
+};
+
+struct aligned_buffer_deleter final
+{
+    void operator()(std::byte* memory) const noexcept
+    {
+        ::operator delete(memory, std::align_val_t{sink_alignment});
+    }
+};
+
+} // namespace detail
+
+// Streams IDs to a file or pipe through a ring of page-aligned buffers: the producer fills one
+// buffer while the others are being written, by io_uring where the kernel allows it and by a
+// pwrite thread otherwise. Pipes and other unseekable files always use the thread, which keeps
+// their writes in order. One producer thread per sink.
+//
+// With O_DIRECT every write is a whole number of 4 KiB blocks except a final partial block,
+// which flush() writes through the page cache; the file stays buffered from then on.
+class uuid_file_sink final
+{
+public:
+    explicit uuid_file_sink(const std::string& path, const file_sink_options& options = {})
+        : uuid_file_sink(open_file(path, options), true, options)
+    {
+    }
+
+    // Writes to an open descriptor, which stays owned by the caller; O_DIRECT is taken from its
+    // status flags.
+    explicit uuid_file_sink(int fd, const file_sink_options& options = {})
+        : uuid_file_sink(fd, false, options)
+    {
+    }
+
+    uuid_file_sink(const uuid_file_sink&) = delete;
+    uuid_file_sink& operator=(const uuid_file_sink&) = delete;
+
+    ~uuid_file_sink()
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    // The raw 16 bytes of each ID.
+    void write(std::span<const uuid> ids)
+    {
+        while (!ids.empty())
+        {
+            const std::span<std::byte> space = buffer();
+            const std::size_t n = std::min(ids.size(), space.size() / uuid::size());
+            if (n == 0)
+            {
+                append(ids.front().bytes().data(), uuid::size());
+                ids = ids.subspan(1);
+                continue;
+            }
+            std::memcpy(space.data(), ids.data(), n * uuid::size());
+            commit(n * uuid::size());
+            ids = ids.subspan(n);
+        }
+    }
+
+    // The canonical text of each ID, one per line.
+    void write_text(std::span<const uuid> ids)
+    {
+        constexpr std::size_t line = 37;
+        while (!ids.empty())
+        {
+            const std::span<std::byte> space = buffer();
+            const std::size_t n = std::min(ids.size(), space.size() / line);
+            if (n == 0)
+            {
+                char text[line];
+                detail::format_uuid(ids.front().bytes(), text);
+                text[line - 1] = '\n';
+                append(text, line);
+                ids = ids.subspan(1);
+                continue;
+            }
+
+            auto* out = reinterpret_cast<char*>(space.data());
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                detail::format_uuid(ids[i].bytes(), out + i * line);
+                out[i * line + line - 1] = '\n';
+            }
+            commit(n * line);
+            ids = ids.subspan(n);
+        }
+    }
+
+    // Zero-copy path: fill a prefix of buffer() in place, then commit() its length. A buffer is
+    // submitted as soon as it is full.
+    [[nodiscard]] std::span<std::byte> buffer()
+    {
+        if (current_ == none)
+        {
+            current_ = acquire();
+        }
+        return std::span<std::byte>(data(current_) + used_, options_.buffer_size - used_);
+    }
+
+    void commit(std::size_t bytes)
+    {
+        used_ += bytes;
+        if (used_ == options_.buffer_size)
+        {
+            submit_current(used_);
+        }
+    }
+
+    // Submits the partly filled buffer and waits until everything written so far is on file.
+    void flush()
+    {
+        if (current_ != none && used_ > 0)
+        {
+            const std::size_t tail = direct_ ? used_ % detail::sink_alignment : 0;
+            if (tail == 0)
+            {
+                submit_current(used_);
+            }
+            else
+            {
+                write_unaligned_tail(tail);
+            }
+        }
+        while (in_flight_ > 0)
+        {
+            free_.push_back(reap());
+        }
+    }
+
+    void close()
+    {
+        if (fd_ < 0)
+        {
+            return;
+        }
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+            // The flush error is the one reported, but an owned descriptor must not leak.
+            stop_writers();
+            if (owns_fd_)
+            {
+                ::close(fd_);
+            }
+            fd_ = -1;
+            throw;
+        }
+        stop_writers();
+        if (owns_fd_ && ::close(fd_) != 0)
+        {
+            fd_ = -1;
+            detail::throw_sink_error(errno, "close");
+        }
+        fd_ = -1;
+    }
+
+    [[nodiscard]] bool uses_io_uring() const noexcept
+    {
+#if UUIDS_HAS_IO_URING
+        return uring_ != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    // Bytes handed to the writer so far, including any still in flight.
+    [[nodiscard]] std::uint64_t bytes_submitted() const noexcept { return offset_ - start_; }
+
+    [[nodiscard]] std::size_t buffer_size() const noexcept { return options_.buffer_size; }
+
+private:
+    static constexpr std::size_t none = static_cast<std::size_t>(-1);
+
+    uuid_file_sink(int fd, bool owns_fd, const file_sink_options& options)
+        : options_{normalized(options)}, fd_{fd}, owns_fd_{owns_fd}
+    {
+        try
+        {
+            buffers_.reset(static_cast<std::byte*>(
+                ::operator new(options_.buffer_size * options_.buffer_count,
+                               std::align_val_t{detail::sink_alignment})));
+
+            const int flags = ::fcntl(fd_, F_GETFL);
+#if defined(O_DIRECT)
+            direct_ = flags >= 0 && (flags & O_DIRECT) != 0;
+#endif
+            const off_t position = ::lseek(fd_, 0, SEEK_CUR);
+            const bool seekable = position >= 0;
+            start_ = offset_ = seekable ? static_cast<std::uint64_t>(position) : 0;
+
+            for (std::size_t i = options_.buffer_count; i > 0; --i)
+            {
+                free_.push_back(i - 1);
+            }
+
+#if UUIDS_HAS_IO_URING
+            if (options_.io_uring && seekable)
+            {
+                try
+                {
+                    uring_ = std::make_unique<detail::uring_writer>(
+                        fd_, buffers_.get(), options_.buffer_size, options_.buffer_count);
+                }
+                catch (const std::system_error&)
+                {
+                }
+            }
+            if (uring_ == nullptr)
+#endif
+            {
+                thread_ = std::make_unique<detail::thread_writer>(fd_, buffers_.get(),
+                                                                  options_.buffer_size, seekable);
+            }
+        }
+        catch (...)
+        {
+            if (owns_fd_)
+            {
+                ::close(fd_);
+            }
+            throw;
+        }
+    }
+
+    [[nodiscard]] static int open_file(const std::string& path, const file_sink_options& options)
+    {
+        int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+#if defined(O_DIRECT)
+        if (options.direct)
+        {
+            flags |= O_DIRECT;
+        }
+#endif
+        const int fd = ::open(path.c_str(), flags, 0644);
+        if (fd < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "open " + path);
+        }
+        return fd;
+    }
+
+    [[nodiscard]] static file_sink_options normalized(file_sink_options options) noexcept
+    {
+        const std::size_t alignment = detail::sink_alignment;
+        options.buffer_size =
+            (std::max(options.buffer_size, alignment) + alignment - 1) / alignment * alignment;
+        options.buffer_count = std::clamp<std::size_t>(options.buffer_count, 2, 64);
+        return options;
+    }
+
+    // Waits for every write still in flight, so none can touch the descriptor afterwards.
+    void stop_writers() noexcept
+    {
+#if UUIDS_HAS_IO_URING
+        uring_.reset();
+#endif
+        thread_.reset();
+    }
+
+    [[nodiscard]] std::byte* data(std::size_t index) const noexcept
+    {
+        return buffers_.get() + index * options_.buffer_size;
+    }
+
+    void append(const void* bytes, std::size_t size)
+    {
+        const auto* source = static_cast<const std::byte*>(bytes);
+        while (size > 0)
+        {
+            const std::span<std::byte> space = buffer();
+            const std::size_t n = std::min(size, space.size());
+            std::memcpy(space.data(), source, n);
+            commit(n);
+            source += n;
+            size -= n;
+        }
+    }
+
+    [[nodiscard]] std::size_t acquire()
+    {
+        if (free_.empty())
+        {
+            return reap();
+        }
+        const std::size_t index = free_.back();
+        free_.pop_back();
+        return index;
+    }
+
+    [[nodiscard]] std::size_t reap()
+    {
+#if UUIDS_HAS_IO_URING
+        const detail::sink_completion done = uring_ != nullptr ? uring_->reap() : thread_->reap();
+#else
+        const detail::sink_completion done = thread_->reap();
+#endif
+        --in_flight_;
+        if (done.error != 0)
+        {
+            free_.push_back(done.index);
+            detail::throw_sink_error(done.error, done.what);
+        }
+        return done.index;
+    }
+
+    void submit_current(std::size_t size)
+    {
+#if UUIDS_HAS_IO_URING
+        if (uring_ != nullptr)
+        {
+            uring_->submit(current_, size, offset_);
+        }
+        else
+#endif
+        {
+            thread_->submit(current_, size, offset_);
+        }
+        ++in_flight_;
+        offset_ += size;
+        current_ = none;
+        used_ = 0;
+    }
+
+    // O_DIRECT cannot write a partial block: the aligned prefix goes out as usual, the rest
+    // synchronously through the page cache once everything before it has landed.
+    void write_unaligned_tail(std::size_t tail)
+    {
+        const std::size_t index = current_;
+        const std::size_t aligned = used_ - tail;
+        if (aligned > 0)
+        {
+            submit_current(aligned);
+        }
+        else
+        {
+            current_ = none;
+            used_ = 0;
+        }
+        while (in_flight_ > 0)
+        {
+            free_.push_back(reap());
+        }
+
+#if defined(O_DIRECT)
+        const int flags = ::fcntl(fd_, F_GETFL);
+        if (flags < 0 || ::fcntl(fd_, F_SETFL, flags & ~O_DIRECT) != 0)
+        {
+            detail::throw_sink_error(errno, "fcntl O_DIRECT");
+        }
+#endif
+        direct_ = false;
+
+        const std::byte* source = data(index) + aligned;
+        std::size_t done = 0;
+        while (done < tail)
+        {
+            const ssize_t n = ::pwrite(fd_, source + done, tail - done,
+                                       static_cast<off_t>(offset_ + done));
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (n <= 0)
+            {
+                detail::throw_sink_error(n < 0 ? errno : EIO, "pwrite");
+            }
+            done += static_cast<std::size_t>(n);
+        }
+        offset_ += tail;
+        if (aligned == 0)
+        {
+            free_.push_back(index);
+        }
+    }
+
+    file_sink_options options_;
+    int fd_;
+    bool owns_fd_;
+    bool direct_{false};
+    std::unique_ptr<std::byte, detail::aligned_buffer_deleter> buffers_;
+    std::vector<std::size_t> free_;
+    std::size_t current_{none};
+    std::size_t used_{0};
+    std::size_t in_flight_{0};
+    std::uint64_t start_{0};
+    std::uint64_t offset_{0};
+#if UUIDS_HAS_IO_URING
+    std::unique_ptr<detail::uring_writer> uring_;
+#endif
+    std::unique_ptr<detail::thread_writer> thread_;
+};
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: FILE_SINK_HPP_e4j7rb */
@@ -0,0 +1,62 @@
+#ifndef HLC_HPP_b2xw8n
+#define HLC_HPP_b2xw8n
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+#include <uuids/uuidv7.hpp>
+
+namespace uuids::inline v1
+{
+
+// Hybrid logical clock over the v7 tick: the 48-bit timestamp is the HLC physical component and
+// the 16-bit counter is its logical component, so HLC order and byte order coincide. Local
+// events take max(last + 1, now); receive() folds in a remote ID so every later local ID sorts
+// after it.
+template <typename PRNG = std::mt19937_64, ClockSource Clock = system_clock_source>
+class basic_hlc_uuid_generator final : public detail::v7_sequence<PRNG, Clock>
+{
+public:
+    using typename detail::v7_sequence<PRNG, Clock>::uuid_type;
+
+    static constexpr std::chrono::milliseconds default_max_drift{std::chrono::minutes(1)};
+
+    constexpr basic_hlc_uuid_generator() noexcept = default;
+
+    explicit constexpr basic_hlc_uuid_generator(std::chrono::milliseconds max_drift) noexcept
+        : max_drift_ms_{static_cast<std::uint64_t>(max_drift.count())}
+    {
+    }
+
+    basic_hlc_uuid_generator(const basic_hlc_uuid_generator&) = delete;
+    basic_hlc_uuid_generator& operator=(const basic_hlc_uuid_generator&) = delete;
+
+    // Rejects remote clocks further than max_drift ahead of local physical time, so a single
+    // misconfigured peer cannot drag every node's clock into the future.
+    bool receive(const uuid_type& remote) noexcept
+    {
+        return receive_tick(detail::v7_layout::decode_tick(detail::uuid_bytes{remote.bytes()}));
+    }
+
+    bool receive_tick(std::uint64_t remote_tick) noexcept
+    {
+        const std::uint64_t remote_ms = remote_tick >> detail::v7_layout::counter_bits;
+        if (remote_ms > Clock::unix_ms() + max_drift_ms_)
+        {
+            return false;
+        }
+
+        this->ticks_.advance_past(remote_tick);
+        return true;
+    }
+
+private:
+    std::uint64_t max_drift_ms_{static_cast<std::uint64_t>(default_max_drift.count())};
+};
+
+using hlc_uuid_generator = basic_hlc_uuid_generator<>;
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: HLC_HPP_b2xw8n */
@@ -0,0 +1,39 @@
+#ifndef PROBES_HPP_d7r2hw
+#define PROBES_HPP_d7r2hw
+
+// USDT (user-level statically defined tracing) probes of provider "uuids", for bpftrace, perf
+// and SystemTap, e.g.
+//
+//     bpftrace -e 'usdt:/path/to/app:uuids:software_fallback { @[ustack] = count(); }'
+//
+// They are compiled in only with UUIDS_ENABLE_USDT (the ENABLE_USDT CMake option), which needs
+// <sys/sdt.h> from systemtap-sdt-dev. A probe nobody attached to is a single nop whose
+// arguments stay in registers; without UUIDS_ENABLE_USDT the macros expand to nothing.
+//
+//   rdrand_failure, rdseed_failure   the instruction returned no value
+//   software_fallback                a v4 ID came from the software engine instead
+//   health_failure(kind)             raw hardware words failed a health test (1 repetition
+//                                    count, 2 adaptive proportion); the hardware is now off
+//   pool_refill_start(bytes)         an entropy pool or buffer starts reading the kernel
+//   pool_refill_end(bytes, ok)       ...and is done; ok is 0 if every source failed
+//   fork_reseed                      buffered entropy was discarded after fork()
+//   v7_batch(count)                  a batch of v7 IDs reserved its timestamps
+//   format_batch(count), parse_batch(count, parsed)   C ABI text conversions
+
+#if defined(UUIDS_ENABLE_USDT)
+#if !__has_include(<sys/sdt.h>)
+#error "UUIDS_ENABLE_USDT needs <sys/sdt.h> (systemtap-sdt-dev)"
+#endif
+#include <sys/sdt.h>
+
+#define UUIDS_PROBE(name) DTRACE_PROBE(uuids, name)
+#define UUIDS_PROBE1(name, a) DTRACE_PROBE1(uuids, name, a)
+#define UUIDS_PROBE2(name, a, b) DTRACE_PROBE2(uuids, name, a, b)
+#else
+// sizeof keeps the arguments referenced without evaluating them.
+#define UUIDS_PROBE(name) static_cast<void>(0)
+#define UUIDS_PROBE1(name, a) static_cast<void>(sizeof(a))
+#define UUIDS_PROBE2(name, a, b) static_cast<void>(sizeof(a) + sizeof(b))
+#endif
+
+#endif /* End of include guard: PROBES_HPP_d7r2hw */
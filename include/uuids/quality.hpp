@@ -0,0 +1,379 @@
+#ifndef QUALITY_HPP_k6w9pb
+#define QUALITY_HPP_k6w9pb
+
+// Statistical checks on the random bits of generated IDs, for vetting a new engine in
+// basic_uuid_generator<PRNG> or a change to the hardware path. Only the 122 bits a v4 ID draws
+// at random are judged; the version nibble and variant bits are skipped. Every statistic is
+// reported as a z-score, so one threshold applies to all of them: with a sound engine each
+// stays within a few units however many IDs are fed in, while a biased one grows with sqrt(n).
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include <simd/common.hpp>
+#include <uuids/bulk.hpp>
+#include <uuids/uuid.hpp>
+
+namespace uuids::inline v1
+{
+
+namespace detail
+{
+
+// Bytes 4..7 and 8..11 read as little-endian words, with the version and variant bits cleared.
+inline constexpr std::array<std::uint32_t, 4> random_word_masks = {0xFFFFFFFF, 0xFF0FFFFF,
+                                                                   0xFFFFFF3F, 0xFFFFFFFF};
+
+// Accumulates the lag-1 serial correlation of the stream of 32-bit words, four per ID, each
+// centred on zero so the sums keep their precision over billions of words.
+struct serial_sums final
+{
+    double sum{0};
+    double sum_squares{0};
+    double sum_products{0};
+    double previous{0};
+};
+
+[[nodiscard]] inline double centred_word(const std::uint8_t* p, std::size_t k) noexcept
+{
+    std::uint32_t word;
+    std::memcpy(&word, p + 4 * k, 4);
+    return static_cast<double>(static_cast<std::int32_t>((word & random_word_masks[k]) ^
+                                                         0x80000000U));
+}
+
+inline void serial_scalar(const std::uint8_t* ids, std::size_t n, serial_sums& sums) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            const double x = centred_word(ids + 16 * i, k);
+            sums.sum += x;
+            sums.sum_squares += x * x;
+            sums.sum_products += x * sums.previous;
+            sums.previous = x;
+        }
+    }
+}
+
+#if SIMD_ARCH_X86
+
+SIMD_TARGET("avx2") inline __m256d centred_words_avx2(const std::uint8_t* p) noexcept
+{
+    const __m128i masks =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(random_word_masks.data()));
+    const __m128i words =
+        _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), masks);
+    return _mm256_cvtepi32_pd(_mm_xor_si128(words, _mm_set1_epi32(INT32_MIN)));
+}
+
+// The four words of an ID fill one register; rotating it by a lane and blending in the last
+// word of the previous ID lines every word up with its predecessor.
+SIMD_TARGET("avx2")
+inline std::size_t serial_avx2(const std::uint8_t* ids, std::size_t n, serial_sums& sums) noexcept
+{
+    __m256d sum = _mm256_setzero_pd();
+    __m256d squares = _mm256_setzero_pd();
+    __m256d products = _mm256_setzero_pd();
+    __m256d rotated = _mm256_set1_pd(sums.previous);
+
+    std::size_t i = 0;
+    for (; i < n; ++i)
+    {
+        const __m256d x = centred_words_avx2(ids + 16 * i);
+        const __m256d x_rotated = _mm256_permute4x64_pd(x, _MM_SHUFFLE(2, 1, 0, 3));
+        const __m256d predecessors = _mm256_blend_pd(x_rotated, rotated, 0b0001);
+        rotated = x_rotated;
+
+        sum = _mm256_add_pd(sum, x);
+        squares = _mm256_add_pd(squares, _mm256_mul_pd(x, x));
+        products = _mm256_add_pd(products, _mm256_mul_pd(x, predecessors));
+    }
+
+    alignas(32) double lanes[3][4];
+    _mm256_store_pd(lanes[0], sum);
+    _mm256_store_pd(lanes[1], squares);
+    _mm256_store_pd(lanes[2], products);
+    sums.sum += (lanes[0][0] + lanes[0][1]) + (lanes[0][2] + lanes[0][3]);
+    sums.sum_squares += (lanes[1][0] + lanes[1][1]) + (lanes[1][2] + lanes[1][3]);
+    sums.sum_products += (lanes[2][0] + lanes[2][1]) + (lanes[2][2] + lanes[2][3]);
+    sums.previous = _mm256_cvtsd_f64(rotated);
+    return i;
+}
+
+#endif
+
+// Sorts keys that are close to uniform over 32 bits, one per bucket on average: a counting pass
+// over the top bits leaves every key a place or two from where it belongs, and an insertion sort
+// finishes the job in about one more pass. offsets needs buckets + 1 entries, a power of two,
+// and scratch as many entries as keys.
+inline void bucket_sort32(std::span<std::uint32_t> keys, std::span<std::uint32_t> scratch,
+                          std::span<std::uint32_t> offsets) noexcept
+{
+    const auto shift = static_cast<unsigned>(32 - std::countr_zero(offsets.size() - 1));
+    std::fill(offsets.begin(), offsets.end(), 0);
+    for (const std::uint32_t key : keys)
+    {
+        ++offsets[(key >> shift) + 1];
+    }
+    for (std::size_t b = 1; b < offsets.size(); ++b)
+    {
+        offsets[b] += offsets[b - 1];
+    }
+    for (const std::uint32_t key : keys)
+    {
+        scratch[offsets[key >> shift]++] = key;
+    }
+
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        const std::uint32_t key = scratch[i];
+        std::size_t j = i;
+        for (; j > 0 && keys[j - 1] > key; --j)
+        {
+            keys[j] = keys[j - 1];
+        }
+        keys[j] = key;
+    }
+}
+
+// Number of equal pairs among values, counted in an open-addressing table of (count << 32 |
+// value) entries with at least twice as many slots as values.
+[[nodiscard]] inline std::uint64_t count_equal_pairs(std::span<const std::uint32_t> values,
+                                                     std::span<std::uint64_t> table) noexcept
+{
+    std::fill(table.begin(), table.end(), 0);
+    const std::size_t mask = table.size() - 1;
+    const auto shift = static_cast<unsigned>(32 - std::countr_zero(table.size()));
+
+    std::uint64_t pairs = 0;
+    for (const std::uint32_t value : values)
+    {
+        std::size_t slot = (value * 0x9E3779B1U) >> shift;
+        for (;; slot = (slot + 1) & mask)
+        {
+            if (table[slot] == 0)
+            {
+                table[slot] = std::uint64_t{1} << 32 | value;
+                break;
+            }
+            if (static_cast<std::uint32_t>(table[slot]) == value)
+            {
+                pairs += table[slot] >> 32;
+                table[slot] += std::uint64_t{1} << 32;
+                break;
+            }
+        }
+    }
+    return pairs;
+}
+
+// Wilson-Hilferty: the z-score of a chi-square statistic with the given degrees of freedom.
+[[nodiscard]] inline double chi_square_z(double chi_square, double degrees) noexcept
+{
+    const double scale = 2.0 / (9.0 * degrees);
+    return (std::cbrt(chi_square / degrees) - (1.0 - scale)) / std::sqrt(scale);
+}
+
+} // namespace detail
+
+struct randomness_report final
+{
+    std::uint64_t ids{0};
+
+    // Largest |z| of the one-count of a single random bit; bit 0 is the most significant bit of
+    // byte 0.
+    double bit_z{0};
+    unsigned bit{0};
+
+    // Largest z of the chi-square of one byte position's value histogram (its random bits only
+    // for bytes 6 and 8).
+    double byte_z{0};
+    unsigned byte{0};
+
+    // Lag-1 correlation of the stream of 32-bit words, four per ID, and its z-score.
+    double serial_correlation{0};
+    double serial_z{0};
+
+    // Marsaglia's birthday spacings on bytes 12..15 of every eighth ID: repeated spacings among
+    // blocks of 4096 birthdays, against their expected count.
+    double birthday_z{0};
+
+    [[nodiscard]] bool passed(double limit = 5.0) const noexcept
+    {
+        return std::abs(bit_z) < limit && std::abs(byte_z) < limit &&
+               std::abs(serial_z) < limit && std::abs(birthday_z) < limit;
+    }
+};
+
+// Feed it IDs with add() in as many batches as convenient, then read report(). Per-byte value
+// histograms carry both the bit and the byte tests, and each batch is walked in L1-sized chunks
+// by the histogram, birthday and serial loops in turn, so the IDs are read from memory once.
+// Sorting birthdays costs several times more per ID than everything else together, which is
+// why only every eighth ID takes part. Holds about 150 KiB of state; keep one per thread.
+class randomness_tester final
+{
+public:
+    static constexpr std::size_t birthdays_per_block = 4096;
+    static constexpr std::size_t birthday_stride = 8;
+    static constexpr std::size_t chunk = 1024;
+
+    randomness_tester()
+        : birthdays_(birthdays_per_block), scratch_(birthdays_per_block),
+          offsets_(birthdays_per_block + 1), spacings_(2 * birthdays_per_block)
+    {
+    }
+
+    void add(std::span<const uuid> ids) noexcept
+    {
+        for (std::size_t first = 0; first < ids.size(); first += chunk)
+        {
+            add_chunk(ids.subspan(first, std::min(chunk, ids.size() - first)));
+        }
+    }
+
+    [[nodiscard]] randomness_report report() const noexcept
+    {
+        randomness_report report;
+        report.ids = ids_;
+        if (ids_ == 0)
+        {
+            return report;
+        }
+
+        const auto n = static_cast<double>(ids_);
+        for (unsigned j = 0; j < 16; ++j)
+        {
+            // Bits 4..7 of byte 6 are the version, bits 6..7 of byte 8 the variant.
+            const unsigned random_bits = j == 6 ? 4 : j == 8 ? 6 : 8;
+            const unsigned bins = 1U << random_bits;
+
+            std::array<std::uint64_t, 256> counts{};
+            for (unsigned v = 0; v < 256; ++v)
+            {
+                counts[v & (bins - 1)] += histograms_[j][v];
+            }
+
+            double chi_square = 0;
+            const double expected = n / bins;
+            for (unsigned v = 0; v < bins; ++v)
+            {
+                const double d = static_cast<double>(counts[v]) - expected;
+                chi_square += d * d / expected;
+            }
+            const double byte_z = detail::chi_square_z(chi_square, bins - 1);
+            if (byte_z > report.byte_z)
+            {
+                report.byte_z = byte_z;
+                report.byte = j;
+            }
+
+            for (unsigned b = 0; b < random_bits; ++b)
+            {
+                std::uint64_t ones = 0;
+                for (unsigned v = 0; v < bins; ++v)
+                {
+                    ones += (v >> b) & 1U ? counts[v] : 0;
+                }
+                const double z = (static_cast<double>(ones) - n / 2) / std::sqrt(n / 4);
+                if (std::abs(z) > std::abs(report.bit_z))
+                {
+                    report.bit_z = z;
+                    report.bit = 8 * j + 7 - b;
+                }
+            }
+        }
+
+        const double words = 4 * n;
+        const double mean = serial_.sum / words;
+        const double variance = serial_.sum_squares / words - mean * mean;
+        if (variance > 0)
+        {
+            report.serial_correlation = (serial_.sum_products / words - mean * mean) / variance;
+            report.serial_z = report.serial_correlation * std::sqrt(words);
+        }
+
+        if (blocks_ != 0)
+        {
+            // Expected equal pairs among the m - 1 gaps between m sorted birthdays out of
+            // 2^32 days: C(m - 1, 2) pairs, each equal with probability m / 2^33.
+            constexpr double m = birthdays_per_block;
+            const double expected =
+                static_cast<double>(blocks_) * m * (m - 1) * (m - 2) / (4.0 * 4294967296.0);
+            report.birthday_z =
+                (static_cast<double>(repeated_spacings_) - expected) / std::sqrt(expected);
+        }
+        return report;
+    }
+
+private:
+    void add_chunk(std::span<const uuid> ids) noexcept
+    {
+        const std::uint8_t* bytes = detail::column_bytes(ids);
+        for (std::size_t i = 0; i < ids.size(); ++i)
+        {
+            const std::uint8_t* p = bytes + 16 * i;
+            for (std::size_t j = 0; j < 16; ++j)
+            {
+                ++histograms_[j][p[j]];
+            }
+        }
+
+        const std::size_t first = (birthday_stride - ids_ % birthday_stride) % birthday_stride;
+        for (std::size_t i = first; i < ids.size(); i += birthday_stride)
+        {
+            std::memcpy(&birthdays_[filled_], bytes + 16 * i + 12, 4);
+            if (++filled_ == birthdays_per_block)
+            {
+                count_repeated_spacings();
+            }
+        }
+
+        std::size_t i = 0;
+#if SIMD_ARCH_X86
+        if (detail::avx2_supported())
+        {
+            i = detail::serial_avx2(bytes, ids.size(), serial_);
+        }
+#endif
+        detail::serial_scalar(bytes + 16 * i, ids.size() - i, serial_);
+        ids_ += ids.size();
+    }
+
+    void count_repeated_spacings() noexcept
+    {
+        detail::bucket_sort32(birthdays_, scratch_, offsets_);
+        for (std::size_t k = birthdays_per_block - 1; k > 0; --k)
+        {
+            birthdays_[k] -= birthdays_[k - 1];
+        }
+        const auto gaps = std::span<const std::uint32_t>(birthdays_).subspan(1);
+        repeated_spacings_ += detail::count_equal_pairs(gaps, spacings_);
+
+        filled_ = 0;
+        ++blocks_;
+    }
+
+    std::array<std::array<std::uint64_t, 256>, 16> histograms_{};
+    detail::serial_sums serial_;
+    std::vector<std::uint32_t> birthdays_;
+    std::vector<std::uint32_t> scratch_;
+    std::vector<std::uint32_t> offsets_;
+    std::vector<std::uint64_t> spacings_;
+    std::size_t filled_{0};
+    std::uint64_t blocks_{0};
+    std::uint64_t repeated_spacings_{0};
+    std::uint64_t ids_{0};
+};
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: QUALITY_HPP_k6w9pb */
@@ -0,0 +1,373 @@
+#ifndef SHM_LEASE_HPP_h8r2ty
+#define SHM_LEASE_HPP_h8r2ty
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "uuids/shm_lease.hpp requires POSIX shared memory"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <uuids/uuidv7.hpp>
+
+namespace uuids::inline v1
+{
+
+namespace detail
+{
+
+// Every field is accessed through std::atomic_ref, and an all-zero segment (fresh ftruncate) is
+// already a valid empty coordinator, so attaching processes never race on initialization.
+struct lease_slot final
+{
+    alignas(64) std::uint64_t owner;
+    std::uint64_t lease_end;
+};
+
+struct lease_segment final
+{
+    static constexpr std::uint64_t magic_value = 0x75756964'6c656173ULL;
+    static constexpr std::size_t max_slots = 256;
+
+    std::uint64_t magic;
+    alignas(64) std::uint64_t next_tick;
+    alignas(64) std::uint64_t epoch;
+    lease_slot slots[max_slots];
+};
+
+static_assert(std::atomic_ref<std::uint64_t>::is_always_lock_free);
+
+[[nodiscard]] inline std::atomic_ref<std::uint64_t> shared_word(std::uint64_t& word) noexcept
+{
+    return std::atomic_ref<std::uint64_t>(word);
+}
+
+[[nodiscard]] constexpr std::uint64_t lease_owner(std::uint64_t epoch, pid_t pid) noexcept
+{
+    return (epoch << 32) | static_cast<std::uint32_t>(pid);
+}
+
+[[nodiscard]] constexpr pid_t lease_owner_pid(std::uint64_t owner) noexcept
+{
+    return static_cast<pid_t>(owner & 0xFFFFFFFFu);
+}
+
+} // namespace detail
+
+struct v7_lease final
+{
+    std::uint64_t first;
+    std::uint64_t end;
+};
+
+// The owner word is (epoch << 32) | pid. Comparing the whole word, not just the pid, tells a
+// worker that its slot was reclaimed and handed to another process even if that process reports
+// the same pid (pid reuse, or a reclaim issued from a different pid namespace).
+struct lease_registration final
+{
+    std::size_t slot;
+    std::uint64_t owner;
+};
+
+// Hands out disjoint, increasing ranges of v7 ticks to any number of processes mapping the same
+// segment. A range is claimed with one CAS on the shared cursor; slots only record which live
+// process holds which range so that a supervisor can reclaim slots of crashed workers. Ranges
+// abandoned by a crash are never reissued because the cursor only moves forward.
+class shm_lease_coordinator final
+{
+public:
+    [[nodiscard]] static shm_lease_coordinator open(const std::string& name)
+    {
+        const int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT, 0600);
+        if (fd < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "shm_open " + name);
+        }
+        return shm_lease_coordinator(fd);
+    }
+
+    [[nodiscard]] static shm_lease_coordinator anonymous()
+    {
+#if defined(__linux__)
+        const int fd = ::memfd_create("uuids-lease", MFD_CLOEXEC);
+        if (fd < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "memfd_create");
+        }
+        return shm_lease_coordinator(fd);
+#else
+        return shm_lease_coordinator(-1);
+#endif
+    }
+
+    static void unlink(const std::string& name) noexcept { ::shm_unlink(name.c_str()); }
+
+    shm_lease_coordinator(shm_lease_coordinator&& other) noexcept
+        : segment_{std::exchange(other.segment_, nullptr)}, fd_{std::exchange(other.fd_, -1)}
+    {
+    }
+
+    shm_lease_coordinator& operator=(shm_lease_coordinator&&) = delete;
+    shm_lease_coordinator(const shm_lease_coordinator&) = delete;
+    shm_lease_coordinator& operator=(const shm_lease_coordinator&) = delete;
+
+    ~shm_lease_coordinator()
+    {
+        if (segment_ != nullptr)
+        {
+            ::munmap(segment_, sizeof(detail::lease_segment));
+        }
+        if (fd_ >= 0)
+        {
+            ::close(fd_);
+        }
+    }
+
+    [[nodiscard]] int fd() const noexcept { return fd_; }
+
+    [[nodiscard]] std::uint64_t epoch() const noexcept
+    {
+        return detail::shared_word(segment_->epoch).load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] lease_registration attach()
+    {
+        for (int attempt = 0; attempt < 2; ++attempt)
+        {
+            const std::uint64_t owner = detail::lease_owner(epoch(), ::getpid());
+            for (std::size_t i = 0; i < detail::lease_segment::max_slots; ++i)
+            {
+                std::uint64_t expected = 0;
+                if (detail::shared_word(segment_->slots[i].owner)
+                        .compare_exchange_strong(expected, owner, std::memory_order_acq_rel))
+                {
+                    return lease_registration{i, owner};
+                }
+            }
+            reclaim_dead();
+        }
+
+        throw std::system_error(std::make_error_code(std::errc::too_many_files_open),
+                                "no free lease slot");
+    }
+
+    void detach(const lease_registration& registration) noexcept
+    {
+        std::uint64_t expected = registration.owner;
+        detail::shared_word(segment_->slots[registration.slot].owner)
+            .compare_exchange_strong(expected, 0, std::memory_order_acq_rel);
+    }
+
+    [[nodiscard]] bool owns(const lease_registration& registration) const noexcept
+    {
+        return detail::shared_word(segment_->slots[registration.slot].owner)
+                   .load(std::memory_order_acquire) == registration.owner;
+    }
+
+    template <ClockSource Clock = system_clock_source>
+    [[nodiscard]] v7_lease lease(const lease_registration& registration,
+                                 std::uint64_t count) noexcept
+    {
+        const std::uint64_t floor = detail::v7_layout::tick(Clock::unix_ms());
+        auto cursor = detail::shared_word(segment_->next_tick);
+
+        std::uint64_t current = cursor.load(std::memory_order_relaxed);
+        std::uint64_t first = 0;
+        do
+        {
+            first = std::max(current, floor);
+        } while (!cursor.compare_exchange_weak(current, first + count, std::memory_order_acq_rel,
+                                               std::memory_order_relaxed));
+
+        detail::shared_word(segment_->slots[registration.slot].lease_end)
+            .store(first + count, std::memory_order_release);
+        return v7_lease{first, first + count};
+    }
+
+    // Frees slots whose owning process no longer exists and bumps the epoch so that a recycled
+    // pid cannot be mistaken for the crashed owner.
+    std::size_t reclaim_dead() noexcept
+    {
+        std::size_t reclaimed = 0;
+        for (auto& slot : segment_->slots)
+        {
+            auto owner_word = detail::shared_word(slot.owner);
+            std::uint64_t owner = owner_word.load(std::memory_order_acquire);
+            if (owner == 0)
+            {
+                continue;
+            }
+
+            if (::kill(detail::lease_owner_pid(owner), 0) != 0 && errno == ESRCH &&
+                owner_word.compare_exchange_strong(owner, 0, std::memory_order_acq_rel))
+            {
+                ++reclaimed;
+            }
+        }
+
+        if (reclaimed != 0)
+        {
+            detail::shared_word(segment_->epoch).fetch_add(1, std::memory_order_acq_rel);
+        }
+        return reclaimed;
+    }
+
+private:
+    explicit shm_lease_coordinator(int fd) : fd_{fd}
+    {
+        int flags = MAP_SHARED;
+        if (fd_ >= 0)
+        {
+            struct stat info{};
+            if (::fstat(fd_, &info) != 0 ||
+                (static_cast<std::size_t>(info.st_size) < sizeof(detail::lease_segment) &&
+                 ::ftruncate(fd_, sizeof(detail::lease_segment)) != 0))
+            {
+                const int error = errno;
+                ::close(fd_);
+                throw std::system_error(error, std::generic_category(), "lease segment size");
+            }
+        }
+        else
+        {
+            flags |= MAP_ANONYMOUS;
+        }
+
+        void* memory = ::mmap(nullptr, sizeof(detail::lease_segment), PROT_READ | PROT_WRITE,
+                              flags, fd_, 0);
+        if (memory == MAP_FAILED)
+        {
+            const int error = errno;
+            if (fd_ >= 0)
+            {
+                ::close(fd_);
+            }
+            throw std::system_error(error, std::generic_category(), "mmap lease segment");
+        }
+        segment_ = static_cast<detail::lease_segment*>(memory);
+
+        std::uint64_t magic = 0;
+        if (!detail::shared_word(segment_->magic)
+                 .compare_exchange_strong(magic, detail::lease_segment::magic_value) &&
+            magic != detail::lease_segment::magic_value)
+        {
+            ::munmap(segment_, sizeof(detail::lease_segment));
+            if (fd_ >= 0)
+            {
+                ::close(fd_);
+            }
+            throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                                    "incompatible lease segment");
+        }
+    }
+
+    detail::lease_segment* segment_{nullptr};
+    int fd_{-1};
+};
+
+// Generates v7 IDs locally from a leased tick range; the coordinator is only touched once per
+// block. Like basic_uuid_generator, one instance is meant to be used by one thread. A forked child
+// drops the range and slot it inherited and attaches under its own pid before generating.
+template <typename PRNG = std::mt19937_64, ClockSource Clock = system_clock_source>
+class basic_leased_uuid_v7_generator final
+{
+public:
+    using uuid_type = uuid;
+
+    static constexpr std::uint64_t default_block_size = 4096;
+
+    explicit basic_leased_uuid_v7_generator(shm_lease_coordinator& coordinator,
+                                            std::uint64_t block_size = default_block_size)
+        : coordinator_{&coordinator}, block_size_{std::max<std::uint64_t>(block_size, 1)},
+          registration_{coordinator.attach()}
+    {
+    }
+
+    basic_leased_uuid_v7_generator(const basic_leased_uuid_v7_generator&) = delete;
+    basic_leased_uuid_v7_generator& operator=(const basic_leased_uuid_v7_generator&) = delete;
+
+    ~basic_leased_uuid_v7_generator()
+    {
+        // A child that never generated still holds its parent's registration.
+        if (generation_ == detail::fork_generation())
+        {
+            coordinator_->detach(registration_);
+        }
+    }
+
+    [[nodiscard]] uuid_type operator()()
+    {
+        if (generation_ != detail::fork_generation()) [[unlikely]]
+        {
+            after_fork();
+        }
+        if (next_ == end_)
+        {
+            refill(block_size_);
+        }
+        return detail::make_v7<PRNG>(next_++);
+    }
+
+    void generate(std::span<uuid_type> out)
+    {
+        for (auto& id : out)
+        {
+            id = (*this)();
+        }
+    }
+
+    // Drops the rest of the current lease, e.g. after a long idle period, so the next ID carries
+    // a current timestamp.
+    void refresh() noexcept { next_ = end_; }
+
+    [[nodiscard]] const lease_registration& registration() const noexcept
+    {
+        return registration_;
+    }
+
+private:
+    void after_fork()
+    {
+        registration_ = coordinator_->attach();
+        generation_ = detail::fork_generation();
+        next_ = end_;
+    }
+
+    void refill(std::uint64_t count)
+    {
+        if (!coordinator_->owns(registration_))
+        {
+            registration_ = coordinator_->attach();
+        }
+
+        const v7_lease lease = coordinator_->template lease<Clock>(registration_, count);
+        next_ = lease.first;
+        end_ = lease.end;
+    }
+
+    shm_lease_coordinator* coordinator_;
+    std::uint64_t block_size_;
+    lease_registration registration_;
+    std::uint64_t next_{0};
+    std::uint64_t end_{0};
+    std::uint64_t generation_{detail::fork_generation()};
+};
+
+using leased_uuid_v7_generator = basic_leased_uuid_v7_generator<>;
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: SHM_LEASE_HPP_h8r2ty */
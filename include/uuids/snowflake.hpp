@@ -0,0 +1,204 @@
+#ifndef SNOWFLAKE_HPP_p5c1zr
+#define SNOWFLAKE_HPP_p5c1zr
+
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <uuids/uuidv7.hpp>
+
+namespace uuids::inline v1
+{
+
+template <typename L>
+concept SnowflakeLayout = requires {
+    { L::timestamp_bits } -> std::convertible_to<unsigned>;
+    { L::worker_bits } -> std::convertible_to<unsigned>;
+    { L::sequence_bits } -> std::convertible_to<unsigned>;
+    { L::epoch_ms } -> std::convertible_to<std::uint64_t>;
+} && (L::timestamp_bits + L::worker_bits + L::sequence_bits <= 63);
+
+struct twitter_snowflake_layout final
+{
+    static constexpr unsigned timestamp_bits = 41;
+    static constexpr unsigned worker_bits = 10;
+    static constexpr unsigned sequence_bits = 12;
+    static constexpr std::uint64_t epoch_ms = 1288834974657;
+};
+
+template <SnowflakeLayout Layout = twitter_snowflake_layout>
+class basic_snowflake final
+{
+public:
+    using layout_type = Layout;
+
+    static constexpr unsigned sequence_shift = 0;
+    static constexpr unsigned worker_shift = Layout::sequence_bits;
+    static constexpr unsigned timestamp_shift = Layout::sequence_bits + Layout::worker_bits;
+
+    static constexpr std::uint64_t sequence_mask = (std::uint64_t{1} << Layout::sequence_bits) - 1;
+    static constexpr std::uint64_t worker_mask = (std::uint64_t{1} << Layout::worker_bits) - 1;
+    static constexpr std::uint64_t timestamp_mask =
+        (std::uint64_t{1} << Layout::timestamp_bits) - 1;
+
+    static constexpr std::size_t text_size = 16;
+
+    constexpr basic_snowflake() noexcept = default;
+
+    explicit constexpr basic_snowflake(std::uint64_t value) noexcept : value_{value} {}
+
+    [[nodiscard]] static constexpr basic_snowflake compose(std::uint64_t timestamp,
+                                                           std::uint64_t worker,
+                                                           std::uint64_t sequence) noexcept
+    {
+        return basic_snowflake(((timestamp & timestamp_mask) << timestamp_shift) |
+                               ((worker & worker_mask) << worker_shift) |
+                               (sequence & sequence_mask));
+    }
+
+    [[nodiscard]] constexpr std::uint64_t value() const noexcept { return value_; }
+
+    [[nodiscard]] constexpr std::uint64_t timestamp() const noexcept
+    {
+        return (value_ >> timestamp_shift) & timestamp_mask;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t unix_ms() const noexcept
+    {
+        return timestamp() + Layout::epoch_ms;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t worker() const noexcept
+    {
+        return (value_ >> worker_shift) & worker_mask;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t sequence() const noexcept
+    {
+        return value_ & sequence_mask;
+    }
+
+    [[nodiscard]] constexpr std::array<std::uint8_t, 8> bytes() const noexcept
+    {
+        std::array<std::uint8_t, 8> result{};
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            result[i] = static_cast<std::uint8_t>(value_ >> (56 - 8 * i));
+        }
+        return result;
+    }
+
+    [[nodiscard]] std::string str() const
+    {
+        std::string result(text_size, '\0');
+        const auto big_endian = bytes();
+        detail::encode_hex(big_endian, result.data());
+        return result;
+    }
+
+    [[nodiscard]] static constexpr std::optional<basic_snowflake>
+    parse(std::string_view text) noexcept
+    {
+        std::array<std::uint8_t, 8> big_endian{};
+        if (!detail::decode_hex(text, big_endian))
+        {
+            return std::nullopt;
+        }
+
+        std::uint64_t value = 0;
+        for (const std::uint8_t byte : big_endian)
+        {
+            value = (value << 8) | byte;
+        }
+        return basic_snowflake(value);
+    }
+
+    [[nodiscard]] constexpr auto operator<=>(const basic_snowflake&) const noexcept = default;
+
+private:
+    std::uint64_t value_{0};
+};
+
+// Sequence overflow within one millisecond carries into the timestamp instead of spinning for
+// the next tick, exactly like the v7 counter; the clock catches up once the burst ends.
+template <SnowflakeLayout Layout = twitter_snowflake_layout,
+          ClockSource Clock = system_clock_source>
+class snowflake_generator final
+{
+public:
+    using id_type = basic_snowflake<Layout>;
+
+    explicit snowflake_generator(std::uint64_t worker) : worker_{worker}
+    {
+        if (worker > id_type::worker_mask)
+        {
+            throw std::out_of_range("snowflake worker id does not fit the layout");
+        }
+    }
+
+    snowflake_generator(const snowflake_generator&) = delete;
+    snowflake_generator& operator=(const snowflake_generator&) = delete;
+
+    [[nodiscard]] id_type operator()() noexcept { return make(ticks_.reserve(1, floor())); }
+
+    void generate(std::span<id_type> out) noexcept
+    {
+        if (out.empty())
+        {
+            return;
+        }
+
+        std::uint64_t tick = ticks_.reserve(out.size(), floor());
+        for (auto& id : out)
+        {
+            id = make(tick++);
+        }
+    }
+
+    [[nodiscard]] std::uint64_t worker() const noexcept { return worker_; }
+
+private:
+    [[nodiscard]] static std::uint64_t floor() noexcept
+    {
+        const std::uint64_t now = Clock::unix_ms();
+        const std::uint64_t since_epoch = now > Layout::epoch_ms ? now - Layout::epoch_ms : 0;
+        return since_epoch << Layout::sequence_bits;
+    }
+
+    [[nodiscard]] id_type make(std::uint64_t tick) const noexcept
+    {
+        return id_type::compose(tick >> Layout::sequence_bits, worker_, tick);
+    }
+
+    detail::monotonic_ticks ticks_;
+    std::uint64_t worker_;
+};
+
+using snowflake = basic_snowflake<>;
+
+} // namespace uuids::inline v1
+
+namespace std
+{
+
+template <uuids::SnowflakeLayout Layout>
+struct hash<uuids::basic_snowflake<Layout>>
+{
+    [[nodiscard]] std::size_t operator()(const uuids::basic_snowflake<Layout>& id) const noexcept
+    {
+        std::uint64_t h = id.value();
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+};
+
+} // namespace std
+
+#endif /* End of include guard: SNOWFLAKE_HPP_p5c1zr */
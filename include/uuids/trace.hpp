@@ -0,0 +1,328 @@
+#ifndef TRACE_HPP_c9h4rm
+#define TRACE_HPP_c9h4rm
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <uuids/uuidv4.hpp>
+
+namespace uuids::inline v1
+{
+
+struct trace_id final
+{
+    std::array<std::uint8_t, 16> bytes{};
+
+    [[nodiscard]] constexpr bool valid() const noexcept { return bytes != decltype(bytes){}; }
+
+    // The trailing 56 bits, which W3C trace context level 2 expects to be random.
+    [[nodiscard]] constexpr std::uint64_t random_bits() const noexcept
+    {
+        std::uint64_t bits = 0;
+        for (std::size_t i = 9; i < 16; ++i)
+        {
+            bits = (bits << 8) | bytes[i];
+        }
+        return bits;
+    }
+
+    [[nodiscard]] constexpr auto operator<=>(const trace_id&) const noexcept = default;
+};
+
+struct span_id final
+{
+    std::array<std::uint8_t, 8> bytes{};
+
+    [[nodiscard]] constexpr bool valid() const noexcept { return bytes != decltype(bytes){}; }
+
+    [[nodiscard]] constexpr auto operator<=>(const span_id&) const noexcept = default;
+};
+
+namespace trace_flags
+{
+
+inline constexpr std::uint8_t sampled = 0x01;
+inline constexpr std::uint8_t random_trace_id = 0x02;
+
+} // namespace trace_flags
+
+struct trace_context final
+{
+    trace_id trace;
+    span_id span;
+    std::uint8_t flags{0};
+
+    [[nodiscard]] constexpr bool sampled() const noexcept
+    {
+        return (flags & trace_flags::sampled) != 0;
+    }
+
+    [[nodiscard]] constexpr auto operator<=>(const trace_context&) const noexcept = default;
+};
+
+// Head sampling keyed on the random bits of the trace-id: every service configured with the same
+// probability reaches the same decision for a trace without coordination.
+class trace_sampler final
+{
+public:
+    constexpr trace_sampler() noexcept = default;
+
+    explicit constexpr trace_sampler(double probability) noexcept
+        : threshold_{probability >= 1.0   ? always
+                     : probability <= 0.0 ? 0
+                                          : static_cast<std::uint64_t>(probability *
+                                                                       static_cast<double>(always))}
+    {
+    }
+
+    [[nodiscard]] constexpr bool operator()(const trace_id& id) const noexcept
+    {
+        return id.random_bits() < threshold_;
+    }
+
+private:
+    static constexpr std::uint64_t always = std::uint64_t{1} << 56;
+
+    std::uint64_t threshold_{always};
+};
+
+namespace detail
+{
+
+// "00-" 32 hex "-" 16 hex "-" 2 hex
+inline constexpr std::size_t traceparent_trace_offset = 3;
+inline constexpr std::size_t traceparent_span_offset = 36;
+inline constexpr std::size_t traceparent_flags_offset = 53;
+
+#if defined(__SSE2__) || defined(_M_X64)
+
+inline void encode_hex16_sse2(const std::uint8_t* bytes, char* out) noexcept
+{
+    const __m128i value = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(bytes));
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i hi = _mm_and_si128(_mm_srli_epi16(value, 4), mask);
+    const __m128i lo = _mm_and_si128(value, mask);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), hex_ascii_sse2(_mm_unpacklo_epi8(hi, lo)));
+}
+
+[[nodiscard]] inline bool decode_hex16_sse2(const char* digits, std::uint8_t* out) noexcept
+{
+    __m128i invalid = _mm_setzero_si128();
+    const __m128i nibbles =
+        hex_nibbles_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits)), invalid);
+    if (_mm_movemask_epi8(invalid) != 0)
+    {
+        return false;
+    }
+
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out),
+                     _mm_packus_epi16(hex_pairs_sse2(nibbles), _mm_setzero_si128()));
+    return true;
+}
+
+#endif
+
+} // namespace detail
+
+inline constexpr std::size_t traceparent_size = 55;
+
+// Writes exactly traceparent_size characters, without a terminator.
+inline char* format_traceparent(const trace_context& context, char* out) noexcept
+{
+    out[0] = '0';
+    out[1] = '0';
+    out[2] = '-';
+    out[35] = '-';
+    out[52] = '-';
+    out[53] = detail::hex_digits[context.flags >> 4];
+    out[54] = detail::hex_digits[context.flags & 0x0F];
+
+#if defined(__SSE2__) || defined(_M_X64)
+    detail::encode_hex32_sse2(context.trace.bytes.data(), out + detail::traceparent_trace_offset);
+    detail::encode_hex16_sse2(context.span.bytes.data(), out + detail::traceparent_span_offset);
+#else
+    detail::encode_hex(context.trace.bytes, out + detail::traceparent_trace_offset);
+    detail::encode_hex(context.span.bytes, out + detail::traceparent_span_offset);
+#endif
+    return out + traceparent_size;
+}
+
+[[nodiscard]] inline std::string to_traceparent(const trace_context& context)
+{
+    std::string header(traceparent_size, '\0');
+    format_traceparent(context, header.data());
+    return header;
+}
+
+// Follows the W3C parsing rules: version ff, all-zero ids and uppercase hex digits (the grammar
+// only has HEXDIGLC) are rejected, and headers of a future version may carry more fields after
+// the flags.
+[[nodiscard]] inline std::optional<trace_context> parse_traceparent(std::string_view text) noexcept
+{
+    if (text.size() < traceparent_size || text[2] != '-' || text[35] != '-' || text[52] != '-')
+    {
+        return std::nullopt;
+    }
+    if (std::any_of(text.begin(), text.begin() + traceparent_size,
+                    [](char c) { return c >= 'A' && c <= 'F'; }))
+    {
+        return std::nullopt;
+    }
+
+    const int version_hi = detail::hex_value(text[0]);
+    const int version_lo = detail::hex_value(text[1]);
+    const int flags_hi = detail::hex_value(text[53]);
+    const int flags_lo = detail::hex_value(text[54]);
+    if ((version_hi | version_lo | flags_hi | flags_lo) < 0)
+    {
+        return std::nullopt;
+    }
+
+    const int version = (version_hi << 4) | version_lo;
+    if (version == 0xFF || (version == 0 && text.size() != traceparent_size) ||
+        (text.size() > traceparent_size && text[traceparent_size] != '-'))
+    {
+        return std::nullopt;
+    }
+
+    trace_context context;
+    context.flags = static_cast<std::uint8_t>((flags_hi << 4) | flags_lo);
+
+    const char* trace_digits = text.data() + detail::traceparent_trace_offset;
+    const char* span_digits = text.data() + detail::traceparent_span_offset;
+#if defined(__SSE2__) || defined(_M_X64)
+    const bool decoded = detail::decode_hex32_sse2(trace_digits, context.trace.bytes.data()) &&
+                         detail::decode_hex16_sse2(span_digits, context.span.bytes.data());
+#else
+    const bool decoded = detail::decode_hex(std::string_view(trace_digits, 32),
+                                            context.trace.bytes) &&
+                         detail::decode_hex(std::string_view(span_digits, 16), context.span.bytes);
+#endif
+    if (!decoded || !context.trace.valid() || !context.span.valid())
+    {
+        return std::nullopt;
+    }
+    return context;
+}
+
+// Trace-ids take two words and span-ids one word from a buffer refilled by one batched PRNG
+// pass, so a new trace costs three loads on the common path. One instance per thread, like
+// basic_uuid_generator. It is not copyable, since a copy would hand out the same IDs; like the v4
+// engine, an entropy-seeded instance reseeds and drops its buffer in a forked child.
+template <typename PRNG = std::mt19937_64>
+    requires detail::RandomNumberEngine<PRNG>
+class basic_trace_id_generator final
+{
+public:
+    static constexpr std::size_t buffer_words = 32;
+
+    basic_trace_id_generator() : rng_(seeded_engine<PRNG>()), entropy_seeded_(true) {}
+
+    explicit basic_trace_id_generator(typename PRNG::result_type seed) noexcept
+        : rng_(seed), entropy_seeded_(false)
+    {
+    }
+
+    basic_trace_id_generator(const basic_trace_id_generator&) = delete;
+    basic_trace_id_generator& operator=(const basic_trace_id_generator&) = delete;
+
+    [[nodiscard]] trace_id next_trace_id() noexcept
+    {
+        trace_id id;
+        do
+        {
+            const std::uint64_t hi = draw();
+            const std::uint64_t lo = draw();
+            std::memcpy(id.bytes.data(), &hi, sizeof(hi));
+            std::memcpy(id.bytes.data() + sizeof(hi), &lo, sizeof(lo));
+        } while (!id.valid());
+        return id;
+    }
+
+    [[nodiscard]] span_id next_span_id() noexcept
+    {
+        span_id id;
+        do
+        {
+            const std::uint64_t word = draw();
+            std::memcpy(id.bytes.data(), &word, sizeof(word));
+        } while (!id.valid());
+        return id;
+    }
+
+    [[nodiscard]] trace_context new_trace(const trace_sampler& sampler = trace_sampler()) noexcept
+    {
+        trace_context context{next_trace_id(), next_span_id(), trace_flags::random_trace_id};
+        if (sampler(context.trace))
+        {
+            context.flags |= trace_flags::sampled;
+        }
+        return context;
+    }
+
+    [[nodiscard]] trace_context child_of(const trace_context& parent) noexcept
+    {
+        return trace_context{parent.trace, next_span_id(), parent.flags};
+    }
+
+private:
+    [[nodiscard]] std::uint64_t draw() noexcept
+    {
+        if (generation_ != detail::fork_generation()) [[unlikely]]
+        {
+            after_fork();
+        }
+        if (next_ == buffer_words)
+        {
+            refill();
+        }
+        return buffer_[next_++];
+    }
+
+    void after_fork() noexcept
+    {
+        generation_ = detail::fork_generation();
+        if (entropy_seeded_)
+        {
+            rng_ = seeded_engine<PRNG>();
+            next_ = buffer_words;
+        }
+    }
+
+    void refill() noexcept
+    {
+        for (auto& word : buffer_)
+        {
+            if constexpr (sizeof(typename PRNG::result_type) >= 8)
+            {
+                word = static_cast<std::uint64_t>(rng_());
+            }
+            else
+            {
+                const auto hi = static_cast<std::uint64_t>(rng_());
+                word = (hi << 32) | static_cast<std::uint32_t>(rng_());
+            }
+        }
+        next_ = 0;
+    }
+
+    PRNG rng_;
+    std::array<std::uint64_t, buffer_words> buffer_{};
+    std::size_t next_{buffer_words};
+    bool entropy_seeded_;
+    std::uint64_t generation_{detail::fork_generation()};
+};
+
+using trace_id_generator = basic_trace_id_generator<>;
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: TRACE_HPP_c9h4rm */
@@ -0,0 +1,421 @@
+#ifndef UUID_HPP_n8v3fa
+#define UUID_HPP_n8v3fa
+
+// The uuid value type with its text codecs and hashing. Deliberately free of <random>, the
+// CPUID machinery and the full intrinsics headers (SSE2 is part of the x86-64 baseline), so
+// code that only stores, compares or prints IDs stays cheap to compile; generators live in
+// uuids/uuidv4.hpp and uuids/uuidv7.hpp.
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iosfwd>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace uuids::inline v1
+{
+
+namespace detail
+{
+
+inline constexpr bool is_little_endian = std::endian::native == std::endian::little;
+
+struct alignas(16) uuid_bytes final
+{
+    std::array<std::uint8_t, 16> data;
+
+    constexpr uuid_bytes() noexcept : data{} {}
+
+    constexpr explicit uuid_bytes(const std::array<std::uint8_t, 16>& bytes) noexcept : data{bytes}
+    {
+    }
+
+    constexpr explicit uuid_bytes(std::span<const std::uint8_t, 16> bytes) noexcept
+    {
+        std::copy(bytes.begin(), bytes.end(), data.begin());
+    }
+
+    [[nodiscard]] constexpr auto operator<=>(const uuid_bytes&) const noexcept = default;
+};
+
+inline constexpr std::string_view hex_digits = "0123456789abcdef";
+
+constexpr char* encode_hex(std::span<const std::uint8_t> bytes, char* out) noexcept
+{
+    for (const std::uint8_t byte : bytes)
+    {
+        *out++ = hex_digits[byte >> 4];
+        *out++ = hex_digits[byte & 0x0F];
+    }
+    return out;
+}
+
+[[nodiscard]] constexpr int hex_value(char c) noexcept
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+[[nodiscard]] constexpr bool decode_hex(std::string_view text, std::span<std::uint8_t> out) noexcept
+{
+    if (text.size() != out.size() * 2)
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        const int hi = hex_value(text[2 * i]);
+        const int lo = hex_value(text[2 * i + 1]);
+        if ((hi | lo) < 0)
+        {
+            return false;
+        }
+        out[i] = static_cast<std::uint8_t>((hi << 4) | lo);
+    }
+    return true;
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+
+[[nodiscard]] inline __m128i hex_ascii_sse2(__m128i nibbles) noexcept
+{
+    const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)),
+                                          _mm_set1_epi8('a' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+}
+
+inline void encode_hex32_sse2(const std::uint8_t* bytes, char* out) noexcept
+{
+    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i hi = _mm_and_si128(_mm_srli_epi16(value, 4), mask);
+    const __m128i lo = _mm_and_si128(value, mask);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), hex_ascii_sse2(_mm_unpacklo_epi8(hi, lo)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16),
+                     hex_ascii_sse2(_mm_unpackhi_epi8(hi, lo)));
+}
+
+#endif
+
+constexpr char* format_uuid(const std::array<std::uint8_t, 16>& bytes, char* out) noexcept
+{
+#if defined(__SSE2__) || defined(_M_X64)
+    if (!std::is_constant_evaluated())
+    {
+        char digits[32];
+        encode_hex32_sse2(bytes.data(), digits);
+        std::memcpy(out, digits, 8);
+        out[8] = '-';
+        std::memcpy(out + 9, digits + 8, 4);
+        out[13] = '-';
+        std::memcpy(out + 14, digits + 12, 4);
+        out[18] = '-';
+        std::memcpy(out + 19, digits + 16, 4);
+        out[23] = '-';
+        std::memcpy(out + 24, digits + 20, 12);
+        return out + 36;
+    }
+#endif
+
+    const std::span<const std::uint8_t, 16> view(bytes);
+    out = encode_hex(view.subspan<0, 4>(), out);
+    *out++ = '-';
+    out = encode_hex(view.subspan<4, 2>(), out);
+    *out++ = '-';
+    out = encode_hex(view.subspan<6, 2>(), out);
+    *out++ = '-';
+    out = encode_hex(view.subspan<8, 2>(), out);
+    *out++ = '-';
+    return encode_hex(view.subspan<10, 6>(), out);
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+
+[[nodiscard]] inline __m128i hex_nibbles_sse2(__m128i chars, __m128i& invalid) noexcept
+{
+    const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    const __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)),
+                                           _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+    const __m128i is_alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                           _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+    invalid = _mm_or_si128(invalid, _mm_xor_si128(_mm_or_si128(is_digit, is_alpha),
+                                                  _mm_set1_epi8(-1)));
+
+    const __m128i digit = _mm_and_si128(is_digit, _mm_sub_epi8(chars, _mm_set1_epi8('0')));
+    const __m128i alpha = _mm_and_si128(is_alpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)));
+    return _mm_or_si128(digit, alpha);
+}
+
+// Each 16-bit lane holds the high nibble in its low byte and the low nibble in its high byte.
+[[nodiscard]] inline __m128i hex_pairs_sse2(__m128i nibbles) noexcept
+{
+    return _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4),
+                        _mm_srli_epi16(nibbles, 8));
+}
+
+[[nodiscard]] inline bool decode_hex32_sse2(const char* digits, std::uint8_t* out) noexcept
+{
+    __m128i invalid = _mm_setzero_si128();
+    const __m128i lo =
+        hex_nibbles_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits)), invalid);
+    const __m128i hi =
+        hex_nibbles_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits + 16)), invalid);
+    if (_mm_movemask_epi8(invalid) != 0)
+    {
+        return false;
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                     _mm_packus_epi16(hex_pairs_sse2(lo), hex_pairs_sse2(hi)));
+    return true;
+}
+
+#endif
+
+// Accepts the canonical 8-4-4-4-12 form and the bare 32 digits, in either case.
+[[nodiscard]] inline bool parse_uuid(std::string_view text,
+                                     std::array<std::uint8_t, 16>& out) noexcept
+{
+    char digits[32];
+    if (text.size() == 36)
+    {
+        if (text[8] != '-' || text[13] != '-' || text[18] != '-' || text[23] != '-')
+        {
+            return false;
+        }
+        std::memcpy(digits, text.data(), 8);
+        std::memcpy(digits + 8, text.data() + 9, 4);
+        std::memcpy(digits + 12, text.data() + 14, 4);
+        std::memcpy(digits + 16, text.data() + 19, 4);
+        std::memcpy(digits + 20, text.data() + 24, 12);
+    }
+    else if (text.size() == 32)
+    {
+        std::memcpy(digits, text.data(), 32);
+    }
+    else
+    {
+        return false;
+    }
+
+#if defined(__SSE2__) || defined(_M_X64)
+    return decode_hex32_sse2(digits, out.data());
+#else
+    return decode_hex(std::string_view(digits, sizeof(digits)), out);
+#endif
+}
+
+// The seed is folded into the low half, so seed 0 leaves the 64-bit std::hash unchanged.
+[[nodiscard]] inline std::uint64_t hash_uuid_bytes64(const std::uint8_t* bytes,
+                                                     std::uint64_t seed) noexcept
+{
+    std::uint64_t h1, h2;
+    std::memcpy(&h1, bytes, 8);
+    std::memcpy(&h2, bytes + 8, 8);
+    h1 ^= seed;
+    return h1 ^ (h2 + 0x9e3779b97f4a7c15ULL + (h1 << 6) + (h1 >> 2));
+}
+
+[[nodiscard]] inline std::size_t hash_uuid_bytes(const std::uint8_t* bytes) noexcept
+{
+    if constexpr (sizeof(std::size_t) == 8)
+    {
+        return hash_uuid_bytes64(bytes, 0);
+    }
+    else
+    {
+        std::uint32_t h = 0;
+        for (std::size_t i = 0; i < 16; i += 4)
+        {
+            std::uint32_t k;
+            std::memcpy(&k, bytes + i, 4);
+            h ^= k;
+            h *= 0x1b873593U;
+        }
+        return h;
+    }
+}
+
+} // namespace detail
+
+class uuid final
+{
+public:
+    using bytes_type = std::array<std::uint8_t, 16>;
+
+    static constexpr std::size_t size() noexcept { return 16; }
+
+    constexpr uuid() noexcept = default;
+
+    explicit constexpr uuid(const bytes_type& bytes) noexcept : data_{bytes} {}
+
+    explicit constexpr uuid(std::span<const std::uint8_t, 16> bytes) noexcept : data_{bytes}
+    {
+    }
+
+    explicit constexpr uuid(detail::uuid_bytes bytes) noexcept : data_{std::move(bytes)} {}
+
+    explicit uuid(std::span<const std::byte, 16> bytes) noexcept
+    {
+        std::memcpy(data_.data.data(), bytes.data(), 16);
+    }
+
+    [[nodiscard]] static std::optional<uuid> parse(std::string_view text) noexcept
+    {
+        bytes_type bytes;
+        if (!detail::parse_uuid(text, bytes))
+        {
+            return std::nullopt;
+        }
+        return uuid(bytes);
+    }
+
+    [[nodiscard]] constexpr const bytes_type& bytes() const noexcept { return data_.data; }
+
+    [[nodiscard]] constexpr std::span<const std::uint8_t, 16> span() const noexcept
+    {
+        return std::span<const std::uint8_t, 16>(data_.data);
+    }
+
+    [[nodiscard]] constexpr std::uint8_t version() const noexcept
+    {
+        return static_cast<std::uint8_t>(data_.data[6] >> 4);
+    }
+
+    [[nodiscard]] constexpr std::uint8_t variant() const noexcept
+    {
+        return static_cast<std::uint8_t>(data_.data[8] >> 6);
+    }
+
+    [[nodiscard]] std::string str() const
+    {
+        std::string result(36, '\0');
+        detail::format_uuid(data_.data, result.data());
+        return result;
+    }
+
+    // The text in a string that allocates through allocator, such as a
+    // std::pmr::polymorphic_allocator<char> over a request arena.
+    template <typename Allocator>
+        requires(!std::is_pointer_v<Allocator>)
+    [[nodiscard]] std::basic_string<char, std::char_traits<char>, Allocator>
+    str(const Allocator& allocator) const
+    {
+        std::basic_string<char, std::char_traits<char>, Allocator> result(36, '\0', allocator);
+        detail::format_uuid(data_.data, result.data());
+        return result;
+    }
+
+    // The text in a std::pmr::string allocated from resource.
+    [[nodiscard]] std::pmr::string str(std::pmr::memory_resource* resource) const
+    {
+        return str(std::pmr::polymorphic_allocator<char>(resource));
+    }
+
+    [[nodiscard]] constexpr auto operator<=>(const uuid&) const noexcept = default;
+
+private:
+    detail::uuid_bytes data_{};
+};
+
+// A 64-bit hash on every target, varied by seed; hash_many() computes the same values for whole
+// columns. Seed 0 gives std::hash<uuid> on 64-bit targets.
+[[nodiscard]] inline std::uint64_t hash_value(const uuid& id, std::uint64_t seed = 0) noexcept
+{
+    return detail::hash_uuid_bytes64(id.bytes().data(), seed);
+}
+
+// Transparent equality between a uuid and its text or 16 wire bytes, for standard unordered
+// containers keyed by uuid and hashed with std::hash (which is transparent as well).
+struct uuid_equal final
+{
+    using is_transparent = void;
+
+    [[nodiscard]] bool operator()(const uuid& a, const uuid& b) const noexcept { return a == b; }
+
+    [[nodiscard]] bool operator()(const uuid& a, std::string_view b) const noexcept
+    {
+        std::array<std::uint8_t, 16> bytes;
+        return detail::parse_uuid(b, bytes) && a.bytes() == bytes;
+    }
+
+    [[nodiscard]] bool operator()(std::string_view a, const uuid& b) const noexcept
+    {
+        return (*this)(b, a);
+    }
+
+    [[nodiscard]] bool operator()(const uuid& a, std::span<const std::byte, 16> b) const noexcept
+    {
+        return std::memcmp(a.bytes().data(), b.data(), 16) == 0;
+    }
+
+    [[nodiscard]] bool operator()(std::span<const std::byte, 16> a, const uuid& b) const noexcept
+    {
+        return (*this)(b, a);
+    }
+};
+
+template <typename CharT, typename Traits>
+inline std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os,
+                                                     const uuid& id)
+{
+    return os << id.str();
+}
+
+} // namespace uuids::inline v1
+
+namespace std
+{
+
+template <>
+struct hash<uuids::uuid>
+{
+    using is_transparent = void;
+
+    [[nodiscard]] std::size_t operator()(const uuids::uuid& id) const noexcept
+    {
+        return uuids::detail::hash_uuid_bytes(id.bytes().data());
+    }
+
+    // Text that is not a uuid hashes to 0; it cannot compare equal to any key anyway.
+    [[nodiscard]] std::size_t operator()(std::string_view text) const noexcept
+    {
+        std::array<std::uint8_t, 16> bytes;
+        return uuids::detail::parse_uuid(text, bytes) ? uuids::detail::hash_uuid_bytes(bytes.data())
+                                                      : 0;
+    }
+
+    [[nodiscard]] std::size_t operator()(std::span<const std::byte, 16> bytes) const noexcept
+    {
+        return uuids::detail::hash_uuid_bytes(reinterpret_cast<const std::uint8_t*>(bytes.data()));
+    }
+};
+
+} // namespace std
+
+#endif /* End of include guard: UUID_HPP_n8v3fa */
@@ -0,0 +1,775 @@
+#ifndef UUID_MAP_HPP_q5m8dz
+#define UUID_MAP_HPP_q5m8dz
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <uuids/uuid.hpp>
+
+// A read prefetch into all cache levels, without the SIMD support headers and their intrinsics.
+#if defined(__GNUC__) || defined(__clang__)
+#define UUIDS_PREFETCH(addr) __builtin_prefetch((addr), 0, 3)
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <xmmintrin.h>
+#define UUIDS_PREFETCH(addr) _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
+#else
+#define UUIDS_PREFETCH(addr) static_cast<void>(addr)
+#endif
+
+namespace uuids::inline v1
+{
+
+namespace detail
+{
+
+// Control bytes, one per slot: empty, deleted (tombstone), or full with the low 7 bits of the
+// slot's hash. Slots are probed in aligned groups of 16 whose control bytes are matched at once.
+inline constexpr std::uint8_t ctrl_empty = 0x80;
+inline constexpr std::uint8_t ctrl_deleted = 0xFE;
+inline constexpr std::size_t group_width = 16;
+
+// Shared by every table without storage, so lookups never need a capacity check.
+alignas(group_width) inline std::uint8_t empty_group[group_width] = {
+    ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+    ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty};
+
+[[nodiscard]] inline std::uint32_t group_match(const std::uint8_t* group, std::uint8_t h2) noexcept
+{
+#if defined(__SSE2__) || defined(_M_X64)
+    const __m128i ctrl = _mm_load_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(static_cast<char>(h2)))));
+#else
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < group_width; ++i)
+    {
+        mask |= static_cast<std::uint32_t>(group[i] == h2) << i;
+    }
+    return mask;
+#endif
+}
+
+// Empty and deleted slots are exactly the ones with the high bit set.
+[[nodiscard]] inline std::uint32_t group_match_free(const std::uint8_t* group) noexcept
+{
+#if defined(__SSE2__) || defined(_M_X64)
+    const __m128i ctrl = _mm_load_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl));
+#else
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < group_width; ++i)
+    {
+        mask |= static_cast<std::uint32_t>(group[i] >> 7) << i;
+    }
+    return mask;
+#endif
+}
+
+// Hash functions are free to leave structure in their low bits (v7 IDs start with a timestamp),
+// so the table mixes every hash once before splitting it into group index and control byte.
+[[nodiscard]] constexpr std::uint64_t table_hash(std::uint64_t hash) noexcept
+{
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+template <typename Key>
+[[nodiscard]] std::optional<Key> as_lookup_key(std::string_view text) noexcept
+{
+    return Key::parse(text);
+}
+
+template <typename Key>
+[[nodiscard]] std::optional<Key> as_lookup_key(std::span<const std::byte, 16> bytes) noexcept
+{
+    return Key(bytes);
+}
+
+// Foreign keys are converted to the key type once, up front; a key that does not parse cannot
+// be in the table, and the probe itself only ever compares 16-byte keys.
+template <typename K, typename Hash, typename Key>
+concept transparent_lookup_key =
+    requires(const K& key) {
+        typename Hash::is_transparent;
+        { as_lookup_key<Key>(key) } -> std::same_as<std::optional<Key>>;
+    } && !std::is_convertible_v<const K&, const Key&>;
+
+template <typename Key, typename T>
+struct map_policy final
+{
+    using key_type = Key;
+    using value_type = std::pair<const Key, T>;
+
+    static constexpr bool is_set = false;
+
+    [[nodiscard]] static const Key& key(const value_type& value) noexcept { return value.first; }
+};
+
+template <typename Key>
+struct set_policy final
+{
+    using key_type = Key;
+    using value_type = Key;
+
+    static constexpr bool is_set = true;
+
+    [[nodiscard]] static const Key& key(const value_type& value) noexcept { return value; }
+};
+
+// Open-addressing table with Swiss-table style control bytes, shared by uuid_map and uuid_set.
+// Rehashing moves elements, so value_type must be nothrow move constructible; references and
+// iterators are invalidated by every insertion that grows the table.
+//
+// Storage comes from a std::pmr::memory_resource, chosen at construction and kept for the
+// table's lifetime as with std::pmr containers: copies start on the default resource, moves keep
+// the source's, and assignment never adopts the other table's resource.
+template <typename Policy, typename Hash>
+class uuid_table
+{
+public:
+    using key_type = typename Policy::key_type;
+    using value_type = typename Policy::value_type;
+    using hasher = Hash;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    static constexpr std::size_t lookup_batch = 32;
+
+    template <bool Const>
+    class basic_iterator final
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename Policy::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+        basic_iterator() noexcept = default;
+
+        template <bool OtherConst>
+            requires(Const && !OtherConst)
+        basic_iterator(const basic_iterator<OtherConst>& other) noexcept
+            : ctrl_{other.ctrl_}, slot_{other.slot_}, end_{other.end_}
+        {
+        }
+
+        [[nodiscard]] reference operator*() const noexcept { return *slot_; }
+
+        [[nodiscard]] pointer operator->() const noexcept { return slot_; }
+
+        basic_iterator& operator++() noexcept
+        {
+            ++ctrl_;
+            ++slot_;
+            skip_free();
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept
+        {
+            basic_iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        [[nodiscard]] friend bool operator==(const basic_iterator& a,
+                                             const basic_iterator& b) noexcept
+        {
+            return a.ctrl_ == b.ctrl_;
+        }
+
+    private:
+        friend class uuid_table;
+        friend class basic_iterator<!Const>;
+
+        basic_iterator(const std::uint8_t* ctrl, pointer slot, const std::uint8_t* end) noexcept
+            : ctrl_{ctrl}, slot_{slot}, end_{end}
+        {
+            skip_free();
+        }
+
+        void skip_free() noexcept
+        {
+            while (ctrl_ != end_ && (*ctrl_ & ctrl_empty) != 0)
+            {
+                ++ctrl_;
+                ++slot_;
+            }
+        }
+
+        const std::uint8_t* ctrl_{nullptr};
+        pointer slot_{nullptr};
+        const std::uint8_t* end_{nullptr};
+    };
+
+    using iterator = basic_iterator<Policy::is_set>;
+    using const_iterator = basic_iterator<true>;
+
+    uuid_table() noexcept = default;
+
+    explicit uuid_table(size_type capacity, const Hash& hash = Hash(),
+                        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : resource_{resource}, hash_{hash}
+    {
+        reserve(capacity);
+    }
+
+    // Takes a capacity, which may be 0, so that uuid_map<T> m(0) cannot also name this overload.
+    uuid_table(size_type capacity, std::pmr::memory_resource* resource)
+        : uuid_table(capacity, Hash(), resource)
+    {
+    }
+
+    uuid_table(const uuid_table& other) : uuid_table(other, std::pmr::get_default_resource()) {}
+
+    uuid_table(const uuid_table& other, std::pmr::memory_resource* resource)
+        : resource_{resource}, hash_{other.hash_}
+    {
+        reserve(other.size_);
+        for (const auto& value : other)
+        {
+            emplace_key(Policy::key(value), value);
+        }
+    }
+
+    uuid_table(uuid_table&& other) noexcept
+        : ctrl_{std::exchange(other.ctrl_, empty_group)},
+          slots_{std::exchange(other.slots_, nullptr)},
+          group_mask_{std::exchange(other.group_mask_, 0)}, size_{std::exchange(other.size_, 0)},
+          growth_left_{std::exchange(other.growth_left_, 0)}, resource_{other.resource_},
+          hash_{std::move(other.hash_)}
+    {
+    }
+
+    uuid_table& operator=(const uuid_table& other)
+    {
+        if (this != &other)
+        {
+            uuid_table copy(other, resource_);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    // Steals the storage when both resources can free each other's memory, else moves the
+    // elements one by one into storage from this table's resource.
+    uuid_table& operator=(uuid_table&& other)
+    {
+        if (*resource_ == *other.resource_)
+        {
+            uuid_table stolen(std::move(other));
+            stolen.resource_ = resource_;
+            swap(stolen);
+        }
+        else
+        {
+            uuid_table moved(other.size_, other.hash_, resource_);
+            for (auto& value : other)
+            {
+                moved.emplace_key(Policy::key(value), std::move(value));
+            }
+            swap(moved);
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~uuid_table() { release(); }
+
+    // Like std::pmr containers, only defined for tables on equal resources.
+    void swap(uuid_table& other) noexcept
+    {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(group_mask_, other.group_mask_);
+        std::swap(size_, other.size_);
+        std::swap(growth_left_, other.growth_left_);
+        std::swap(resource_, other.resource_);
+        std::swap(hash_, other.hash_);
+    }
+
+    [[nodiscard]] iterator begin() noexcept { return iterator_at(0); }
+    [[nodiscard]] const_iterator begin() const noexcept { return const_iterator_at(0); }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] iterator end() noexcept { return iterator_at(capacity()); }
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator_at(capacity()); }
+    [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return slots_ == nullptr ? 0 : (group_mask_ + 1) * group_width;
+    }
+
+    [[nodiscard]] hasher hash_function() const { return hash_; }
+
+    [[nodiscard]] std::pmr::memory_resource* resource() const noexcept { return resource_; }
+
+    void clear() noexcept
+    {
+        if (slots_ == nullptr)
+        {
+            return;
+        }
+
+        destroy_values();
+        std::memset(ctrl_, ctrl_empty, capacity());
+        size_ = 0;
+        growth_left_ = max_load(capacity());
+    }
+
+    void reserve(size_type count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        std::size_t groups = 1;
+        while (max_load(groups * group_width) < count)
+        {
+            groups *= 2;
+        }
+        if (groups * group_width > capacity())
+        {
+            rehash_groups(groups);
+        }
+    }
+
+    [[nodiscard]] iterator find(const key_type& key) noexcept
+    {
+        const std::size_t index = find_index(key, hash_of(key));
+        return index == npos ? end() : iterator_at(index);
+    }
+
+    [[nodiscard]] const_iterator find(const key_type& key) const noexcept
+    {
+        const std::size_t index = find_index(key, hash_of(key));
+        return index == npos ? end() : const_iterator_at(index);
+    }
+
+    [[nodiscard]] bool contains(const key_type& key) const noexcept
+    {
+        return find_index(key, hash_of(key)) != npos;
+    }
+
+    [[nodiscard]] size_type count(const key_type& key) const noexcept
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <transparent_lookup_key<Hash, key_type> K>
+    [[nodiscard]] iterator find(const K& key) noexcept
+    {
+        const std::optional<key_type> converted = as_lookup_key<key_type>(key);
+        return converted ? find(*converted) : end();
+    }
+
+    template <transparent_lookup_key<Hash, key_type> K>
+    [[nodiscard]] const_iterator find(const K& key) const noexcept
+    {
+        const std::optional<key_type> converted = as_lookup_key<key_type>(key);
+        return converted ? find(*converted) : end();
+    }
+
+    template <transparent_lookup_key<Hash, key_type> K>
+    [[nodiscard]] bool contains(const K& key) const noexcept
+    {
+        const std::optional<key_type> converted = as_lookup_key<key_type>(key);
+        return converted && contains(*converted);
+    }
+
+    template <transparent_lookup_key<Hash, key_type> K>
+    [[nodiscard]] size_type count(const K& key) const noexcept
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    size_type erase(const key_type& key) noexcept
+    {
+        const std::size_t index = find_index(key, hash_of(key));
+        if (index == npos)
+        {
+            return 0;
+        }
+        erase_at(index);
+        return 1;
+    }
+
+    iterator erase(const_iterator position) noexcept
+    {
+        const auto index = static_cast<std::size_t>(position.ctrl_ - ctrl_);
+        erase_at(index);
+        return iterator_at(index + 1);
+    }
+
+    // Looks up a whole batch with group prefetching: hash every key and prefetch its control
+    // group, then match the (now cached) control bytes and prefetch the candidate slot, and only
+    // then compare keys. The misses of one batch overlap instead of being paid one after another.
+    // callback(index, pointer) is invoked in key order; pointer is null for absent keys.
+    template <typename F>
+    void lookup_many(std::span<const key_type> keys, F&& callback)
+    {
+        lookup_many_impl(*this, keys, callback);
+    }
+
+    template <typename F>
+    void lookup_many(std::span<const key_type> keys, F&& callback) const
+    {
+        lookup_many_impl(*this, keys, callback);
+    }
+
+protected:
+    template <typename... Args>
+    std::pair<iterator, bool> emplace_key(const key_type& key, Args&&... args)
+    {
+        const std::uint64_t hash = hash_of(key);
+        if (const std::size_t found = find_index(key, hash); found != npos)
+        {
+            return {iterator_at(found), false};
+        }
+
+        if (growth_left_ == 0)
+        {
+            grow();
+        }
+
+        const std::size_t index = find_free(hash);
+        std::construct_at(slots_ + index, std::forward<Args>(args)...);
+        if (ctrl_[index] == ctrl_empty)
+        {
+            --growth_left_;
+        }
+        ctrl_[index] = h2_of(hash);
+        ++size_;
+        return {iterator_at(index), true};
+    }
+
+private:
+    static_assert(std::is_nothrow_move_constructible_v<value_type>);
+
+    static constexpr std::size_t npos = ~std::size_t{0};
+    static constexpr std::size_t ctrl_alignment = 64;
+    static constexpr std::size_t slot_alignment = std::max(alignof(value_type), ctrl_alignment);
+
+    [[nodiscard]] static constexpr std::size_t max_load(std::size_t capacity) noexcept
+    {
+        return capacity - capacity / 8;
+    }
+
+    [[nodiscard]] static constexpr std::uint8_t h2_of(std::uint64_t hash) noexcept
+    {
+        return static_cast<std::uint8_t>(hash & 0x7F);
+    }
+
+    [[nodiscard]] std::uint64_t hash_of(const key_type& key) const noexcept
+    {
+        return table_hash(hash_(key));
+    }
+
+    [[nodiscard]] std::size_t first_group(std::uint64_t hash) const noexcept
+    {
+        return (hash >> 7) & group_mask_;
+    }
+
+    [[nodiscard]] iterator iterator_at(std::size_t index) noexcept
+    {
+        return iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity());
+    }
+
+    [[nodiscard]] const_iterator const_iterator_at(std::size_t index) const noexcept
+    {
+        return const_iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity());
+    }
+
+    // Triangular probing over a power-of-two number of groups visits every group, and the load
+    // limit guarantees some group has an empty slot, so both loops terminate.
+    [[nodiscard]] std::size_t find_index(const key_type& key, std::uint64_t hash) const noexcept
+    {
+        const std::uint8_t h2 = h2_of(hash);
+        std::size_t group = first_group(hash);
+
+        for (std::size_t step = 1;; ++step)
+        {
+            const std::uint8_t* ctrl = ctrl_ + group * group_width;
+            for (std::uint32_t match = group_match(ctrl, h2); match != 0; match &= match - 1)
+            {
+                const std::size_t index =
+                    group * group_width + static_cast<std::size_t>(std::countr_zero(match));
+                if (Policy::key(slots_[index]) == key)
+                {
+                    return index;
+                }
+            }
+
+            if (group_match(ctrl, ctrl_empty) != 0)
+            {
+                return npos;
+            }
+            group = (group + step) & group_mask_;
+        }
+    }
+
+    [[nodiscard]] std::size_t find_free(std::uint64_t hash) const noexcept
+    {
+        std::size_t group = first_group(hash);
+
+        for (std::size_t step = 1;; ++step)
+        {
+            const std::uint32_t match = group_match_free(ctrl_ + group * group_width);
+            if (match != 0)
+            {
+                return group * group_width + static_cast<std::size_t>(std::countr_zero(match));
+            }
+            group = (group + step) & group_mask_;
+        }
+    }
+
+    // A slot whose group still has an empty slot never caused a probe to continue past that
+    // group, so it can become empty again instead of a tombstone.
+    void erase_at(std::size_t index) noexcept
+    {
+        std::destroy_at(slots_ + index);
+        if (group_match(ctrl_ + index / group_width * group_width, ctrl_empty) != 0)
+        {
+            ctrl_[index] = ctrl_empty;
+            ++growth_left_;
+        }
+        else
+        {
+            ctrl_[index] = ctrl_deleted;
+        }
+        --size_;
+    }
+
+    // Out of room: rehash in place size when tombstones make up most of the load, else double.
+    void grow()
+    {
+        const std::size_t groups = capacity() / group_width;
+        if (groups == 0)
+        {
+            rehash_groups(1);
+        }
+        else if (size_ * 2 <= max_load(capacity()))
+        {
+            rehash_groups(groups);
+        }
+        else
+        {
+            rehash_groups(groups * 2);
+        }
+    }
+
+    void rehash_groups(std::size_t groups)
+    {
+        uuid_table fresh(0, hash_, resource_);
+        const std::size_t new_capacity = groups * group_width;
+        auto* ctrl = static_cast<std::uint8_t*>(resource_->allocate(new_capacity, ctrl_alignment));
+        value_type* slots = nullptr;
+        try
+        {
+            slots = static_cast<value_type*>(
+                resource_->allocate(new_capacity * sizeof(value_type), slot_alignment));
+        }
+        catch (...)
+        {
+            resource_->deallocate(ctrl, new_capacity, ctrl_alignment);
+            throw;
+        }
+        std::memset(ctrl, ctrl_empty, new_capacity);
+
+        fresh.ctrl_ = ctrl;
+        fresh.slots_ = slots;
+        fresh.group_mask_ = groups - 1;
+
+        for (std::size_t i = 0, old_capacity = capacity(); i < old_capacity; ++i)
+        {
+            if ((ctrl_[i] & ctrl_empty) != 0)
+            {
+                continue;
+            }
+
+            const std::uint64_t hash = hash_of(Policy::key(slots_[i]));
+            const std::size_t index = fresh.find_free(hash);
+            std::construct_at(fresh.slots_ + index, std::move(slots_[i]));
+            fresh.ctrl_[index] = h2_of(hash);
+            std::destroy_at(slots_ + i);
+            ctrl_[i] = ctrl_empty;
+        }
+
+        fresh.size_ = size_;
+        fresh.growth_left_ = max_load(new_capacity) - size_;
+        size_ = 0;
+        swap(fresh);
+    }
+
+    void destroy_values() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<value_type>)
+        {
+            for (std::size_t i = 0, n = capacity(); i < n; ++i)
+            {
+                if ((ctrl_[i] & ctrl_empty) == 0)
+                {
+                    std::destroy_at(slots_ + i);
+                }
+            }
+        }
+    }
+
+    void release() noexcept
+    {
+        if (slots_ == nullptr)
+        {
+            return;
+        }
+
+        const std::size_t old_capacity = capacity();
+        destroy_values();
+        resource_->deallocate(ctrl_, old_capacity, ctrl_alignment);
+        resource_->deallocate(slots_, old_capacity * sizeof(value_type), slot_alignment);
+    }
+
+    template <typename Self, typename F>
+    static void lookup_many_impl(Self& self, std::span<const key_type> keys, F& callback)
+    {
+        using pointer = std::conditional_t<std::is_const_v<Self> || Policy::is_set,
+                                           const value_type*, value_type*>;
+
+        std::uint64_t hashes[lookup_batch];
+        for (std::size_t base = 0; base < keys.size(); base += lookup_batch)
+        {
+            const std::size_t count = std::min(lookup_batch, keys.size() - base);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                hashes[i] = self.hash_of(keys[base + i]);
+                UUIDS_PREFETCH(self.ctrl_ + self.first_group(hashes[i]) * group_width);
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const std::size_t group = self.first_group(hashes[i]);
+                const std::uint32_t match =
+                    group_match(self.ctrl_ + group * group_width, h2_of(hashes[i]));
+                if (match != 0)
+                {
+                    UUIDS_PREFETCH(self.slots_ + group * group_width +
+                                   static_cast<std::size_t>(std::countr_zero(match)));
+                }
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const std::size_t index = self.find_index(keys[base + i], hashes[i]);
+                callback(base + i, index == npos ? pointer{nullptr} : pointer{self.slots_ + index});
+            }
+        }
+    }
+
+    std::uint8_t* ctrl_{empty_group};
+    value_type* slots_{nullptr};
+    std::size_t group_mask_{0};
+    std::size_t size_{0};
+    std::size_t growth_left_{0};
+    std::pmr::memory_resource* resource_{std::pmr::get_default_resource()};
+    [[no_unique_address]] Hash hash_{};
+};
+
+} // namespace detail
+
+template <typename T, typename Key = uuid, typename Hash = std::hash<Key>>
+class uuid_map final : public detail::uuid_table<detail::map_policy<Key, T>, Hash>
+{
+    using base = detail::uuid_table<detail::map_policy<Key, T>, Hash>;
+
+public:
+    using mapped_type = T;
+    using typename base::iterator;
+    using typename base::value_type;
+
+    using base::base;
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        return this->emplace_key(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                 std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return this->emplace_key(value.first, value);
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value)
+    {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second)
+        {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    T& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+    [[nodiscard]] T& at(const Key& key)
+    {
+        auto it = this->find(key);
+        if (it == this->end())
+        {
+            throw std::out_of_range("uuid_map::at");
+        }
+        return it->second;
+    }
+
+    [[nodiscard]] const T& at(const Key& key) const
+    {
+        auto it = this->find(key);
+        if (it == this->end())
+        {
+            throw std::out_of_range("uuid_map::at");
+        }
+        return it->second;
+    }
+};
+
+template <typename Key = uuid, typename Hash = std::hash<Key>>
+class uuid_set final : public detail::uuid_table<detail::set_policy<Key>, Hash>
+{
+    using base = detail::uuid_table<detail::set_policy<Key>, Hash>;
+
+public:
+    using typename base::iterator;
+
+    using base::base;
+
+    std::pair<iterator, bool> insert(const Key& key) { return this->emplace_key(key, key); }
+};
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: UUID_MAP_HPP_q5m8dz */
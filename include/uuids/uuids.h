@@ -0,0 +1,69 @@
+#ifndef UUIDS_H_w5k2pe
+#define UUIDS_H_w5k2pe
+
+// C ABI of the compiled uuids library, meant for FFI callers (Python, Go, Rust). Every entry
+// point works on whole batches so the cost of crossing the language boundary is paid once per
+// batch rather than once per ID. IDs are 16 raw bytes in RFC 9562 (network) order and text is
+// the 36-character canonical form, packed back to back without terminators.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32) && defined(UUIDS_SHARED)
+#if defined(UUIDS_BUILDING)
+#define UUIDS_API __declspec(dllexport)
+#else
+#define UUIDS_API __declspec(dllimport)
+#endif
+#elif defined(__GNUC__) || defined(__clang__)
+#define UUIDS_API __attribute__((visibility("default")))
+#else
+#define UUIDS_API
+#endif
+
+#define UUIDS_ABI_VERSION 1
+#define UUIDS_TEXT_SIZE 36
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Returns UUIDS_ABI_VERSION of the library actually loaded.
+UUIDS_API uint32_t uuids_abi_version(void);
+
+// Writes n random (version 4) IDs, 16 * n bytes, from the calling thread's generator.
+UUIDS_API void uuids_generate_v4(uint8_t* out, size_t n);
+
+// Writes n time-ordered (version 7) IDs, strictly increasing across all threads that call this
+// function. The order comes from the library's own shared_uuid_v7_generator::global(); when
+// libuuids is a shared library, header-only C++ code in the same process has a separate instance
+// and is not ordered with these IDs. A static libuuids shares the instance with that code.
+UUIDS_API void uuids_generate_v7(uint8_t* out, size_t n);
+
+// Writes UUIDS_TEXT_SIZE * n lowercase characters for the n IDs at in.
+UUIDS_API void uuids_format_many(const uint8_t* in, size_t n, char* out);
+
+// Parses n IDs of UUIDS_TEXT_SIZE characters each. Returns n on success, otherwise the index of
+// the first malformed ID; the IDs before it have been written.
+UUIDS_API size_t uuids_parse_many(const char* in, size_t n, uint8_t* out);
+
+// Writes the hash of each of the n IDs at in, equal to std::hash<uuids::uuid> of the same ID.
+UUIDS_API void uuids_hash_many(const uint8_t* in, size_t n, uint64_t* out);
+
+// An owned version 4 generator, for callers that manage their own threads. A handle is not
+// thread-safe: use one per thread, or serialize calls to it.
+typedef struct uuids_generator uuids_generator;
+
+// Returns NULL if allocation fails.
+UUIDS_API uuids_generator* uuids_generator_new(void);
+
+UUIDS_API void uuids_generator_free(uuids_generator* generator);
+
+UUIDS_API void uuids_generator_v4(uuids_generator* generator, uint8_t* out, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* End of include guard: UUIDS_H_w5k2pe */
@@ -2,13 +2,18 @@
 #define UUIDV4_HPP_xir2zk
 
 #include <array>
-#include <bit>
+#include <atomic>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <random>
 #include <span>
 
 #include <simd/feature_check.hpp>
+#include <uuids/entropy.hpp>
+#include <uuids/probes.hpp>
+#include <uuids/uuid.hpp>
 
 #if defined(__x86_64__) || defined(_M_X64)
 #ifdef _MSC_VER
@@ -32,24 +37,6 @@ concept RandomNumberEngine = requires(T& eng) {
     { T::max() } -> std::same_as<typename T::result_type>;
 };
 
-inline constexpr bool is_little_endian = std::endian::native == std::endian::little;
-
-struct alignas(16) uuid_bytes final
-{
-    std::array<std::uint8_t, 16> data;
-
-    constexpr uuid_bytes() noexcept : data{} {}
-
-    constexpr explicit uuid_bytes(const std::array<std::uint8_t, 16>& bytes) noexcept : data{bytes}
-    {
-    }
-
-    constexpr explicit uuid_bytes(std::span<const std::uint8_t, 16> bytes) noexcept
-    {
-        std::copy(bytes.begin(), bytes.end(), data.begin());
-    }
-};
-
 class hardware_rng final
 {
 public:
@@ -71,54 +58,74 @@ public:
         return supported;
     }
 
-    [[nodiscard]] static std::uint64_t rdrand() noexcept
+    // Whether rdrand() or rdseed() can return anything at all: the instructions are only
+    // compiled in when the target enables them.
+    [[nodiscard]] static bool available() noexcept
+    {
+        return (simd::compile_time::has<simd::Feature::RDRND>() && rdrand_supported()) ||
+               (simd::compile_time::has<simd::Feature::RDSEED>() && rdseed_supported());
+    }
+
+    // A clear carry flag only means the DRNG was momentarily drained, so both instructions are
+    // retried a few times, as Intel recommends, before reporting that no value was available.
+    static constexpr int retries = 10;
+
+    [[nodiscard]] static bool rdrand(std::uint64_t& out) noexcept
     {
         if (!rdrand_supported())
         {
-            return 0;
+            return false;
         }
 
 #if defined(__x86_64__) || defined(_M_X64)
-        std::uint64_t value = 0;
-
-        if (simd::compile_time::has<simd::Feature::RDRND>())
+        if constexpr (simd::compile_time::has<simd::Feature::RDRND>())
         {
+            for (int attempt = 0; attempt < retries; ++attempt)
+            {
+                unsigned long long value = 0;
 #ifdef _MSC_VER
-            _rdrand64_step(&value);
+                const int ok = _rdrand64_step(&value);
 #elif defined(__GNUC__) || defined(__clang__)
-            __builtin_ia32_rdrand64_step(&value);
+                const int ok = __builtin_ia32_rdrand64_step(&value);
 #endif
+                if (ok != 0)
+                {
+                    out = static_cast<std::uint64_t>(value);
+                    return true;
+                }
+            }
         }
-
-        return value;
-#else
-        return 0;
 #endif
+        return false;
     }
 
-    [[nodiscard]] static std::uint64_t rdseed() noexcept
+    [[nodiscard]] static bool rdseed(std::uint64_t& out) noexcept
     {
         if (!rdseed_supported())
         {
-            return 0;
+            return false;
         }
 
 #if defined(__x86_64__) || defined(_M_X64)
-        std::uint64_t value = 0;
-
-        if (simd::compile_time::has<simd::Feature::RDSEED>())
+        if constexpr (simd::compile_time::has<simd::Feature::RDSEED>())
         {
+            for (int attempt = 0; attempt < retries; ++attempt)
+            {
+                unsigned long long value = 0;
 #ifdef _MSC_VER
-            _rdseed64_step(&value);
+                const int ok = _rdseed64_step(&value);
 #elif defined(__GNUC__) || defined(__clang__)
-            __builtin_ia32_rdseed64_step(&value);
+                const int ok = __builtin_ia32_rdseed_di_step(&value);
 #endif
+                if (ok != 0)
+                {
+                    out = static_cast<std::uint64_t>(value);
+                    return true;
+                }
+            }
         }
-
-        return value;
-#else
-        return 0;
 #endif
+        return false;
     }
 
     [[nodiscard]] static __m128i aesni_enc(__m128i key, __m128i data) noexcept
@@ -129,7 +136,7 @@ public:
         }
 
 #if defined(__x86_64__) || defined(_M_X64)
-        if (simd::compile_time::has<simd::Feature::AES>())
+        if constexpr (simd::compile_time::has<simd::Feature::AES>())
         {
             return _mm_aesenc_si128(data, key);
         }
@@ -138,6 +145,96 @@ public:
     }
 };
 
+// SP 800-90B section 4.4 continuous health tests on raw hardware words, run on a whole block
+// before any word of it is used. Each 64-bit word is assumed to carry at least 32 bits of
+// min-entropy and the false-alarm rate is 2^-40, which puts both cutoffs at 3: three equal words
+// in a row fail the repetition count test, and three occurrences of a window's first word among
+// its 512 fail the adaptive proportion test. A part stuck at all-ones, or any other constant,
+// fails within its first block.
+class entropy_health_test final
+{
+public:
+    static constexpr std::size_t block_words = 16;
+    static constexpr std::size_t window_words = 512;
+    static constexpr unsigned cutoff = 3;
+
+    enum class verdict
+    {
+        pass,
+        repetition,
+        proportion
+    };
+
+    [[nodiscard]] verdict test(std::span<const std::uint64_t, block_words> block) noexcept
+    {
+        // Both fast paths are branch-free compares the compiler vectorizes; only a block that
+        // holds equal neighbours walks its runs one word at a time.
+        bool repeated = started_ && block[0] == last_;
+        for (std::size_t i = 1; i < block_words; ++i)
+        {
+            repeated |= block[i] == block[i - 1];
+        }
+        if (repeated)
+        {
+            for (const std::uint64_t word : block)
+            {
+                run_ = started_ && word == last_ ? run_ + 1 : 1;
+                last_ = word;
+                started_ = true;
+                if (run_ >= cutoff)
+                {
+                    return verdict::repetition;
+                }
+            }
+        }
+        else
+        {
+            run_ = 1;
+            last_ = block[block_words - 1];
+            started_ = true;
+        }
+
+        std::size_t first = 0;
+        if (window_position_ == 0)
+        {
+            reference_ = block[0];
+            matches_ = 1;
+            first = 1;
+        }
+        unsigned matches = 0;
+        for (std::size_t i = first; i < block_words; ++i)
+        {
+            matches += block[i] == reference_ ? 1u : 0u;
+        }
+        matches_ += matches;
+        window_position_ = (window_position_ + block_words) % window_words;
+        return matches_ >= cutoff ? verdict::proportion : verdict::pass;
+    }
+
+private:
+    static_assert(window_words % block_words == 0);
+
+    std::uint64_t last_{0};
+    std::uint64_t reference_{0};
+    std::size_t window_position_{0};
+    unsigned run_{0};
+    unsigned matches_{0};
+    bool started_{false};
+};
+
+// Process-wide: once any generator's health test fails, every generator stops trusting the
+// hardware and stays on its own engine for the life of the process.
+struct hardware_health_counters final
+{
+    std::atomic<std::uint64_t> blocks{0};
+    std::atomic<std::uint64_t> unavailable{0};
+    std::atomic<std::uint64_t> repetition_failures{0};
+    std::atomic<std::uint64_t> proportion_failures{0};
+    std::atomic<bool> disabled{false};
+};
+
+inline hardware_health_counters hardware_health;
+
 template <typename PRNG = std::mt19937_64>
     requires RandomNumberEngine<PRNG>
 class optimized_generator final
@@ -145,62 +242,119 @@ class optimized_generator final
 public:
     using result_type = uuid_bytes;
 
-    optimized_generator() noexcept : rng_(std::random_device{}()), use_hw_rng_(setup_hw_rng()) {}
+    optimized_generator() noexcept
+        : rng_(seeded_engine<PRNG>()), use_hw_rng_(setup_hw_rng()), entropy_seeded_(true)
+    {
+    }
 
+    // Explicitly seeded engines keep their sequence across fork(); only entropy-seeded ones are
+    // reseeded in the child.
     explicit optimized_generator(typename PRNG::result_type seed) noexcept
-        : rng_(seed), use_hw_rng_(setup_hw_rng())
+        : rng_(seed), use_hw_rng_(setup_hw_rng()), entropy_seeded_(false)
+    {
+    }
+
+    // Copies never share buffered hardware words, which would repeat IDs.
+    optimized_generator(const optimized_generator& other) noexcept
+        : rng_(other.rng_), use_hw_rng_(other.use_hw_rng_), entropy_seeded_(other.entropy_seeded_),
+          generation_(other.generation_), health_(other.health_)
+    {
+    }
+
+    optimized_generator& operator=(const optimized_generator& other) noexcept
     {
+        rng_ = other.rng_;
+        use_hw_rng_ = other.use_hw_rng_;
+        entropy_seeded_ = other.entropy_seeded_;
+        generation_ = other.generation_;
+        health_ = other.health_;
+        hw_next_ = hw_block_.size();
+        return *this;
     }
 
     [[nodiscard]] result_type operator()() noexcept
     {
+        if (generation_ != fork_generation()) [[unlikely]]
+        {
+            after_fork();
+        }
         return use_hw_rng_ ? generate_hw() : generate_sw();
     }
 
 private:
-    [[nodiscard]] static bool setup_hw_rng() noexcept
+    // The child of a fork() holds a copy of the engine state and of any buffered hardware words;
+    // left alone, parent and child would produce the same IDs.
+    void after_fork() noexcept
     {
-        return simd::has_feature(simd::Feature::RDRND) || simd::has_feature(simd::Feature::RDSEED);
+        generation_ = fork_generation();
+        hw_next_ = hw_block_.size();
+        if (entropy_seeded_)
+        {
+            rng_ = seeded_engine<PRNG>();
+        }
     }
 
-    [[nodiscard]] result_type generate_hw() noexcept
+    [[nodiscard]] static bool setup_hw_rng() noexcept
     {
-        uuid_bytes uuid;
-        std::span<std::uint8_t, 16> uuid_span(uuid.data);
-
-        bool used_hw_rng = false;
+        return hardware_rng::available() &&
+               !hardware_health.disabled.load(std::memory_order_relaxed);
+    }
 
-        if (hardware_rng::rdrand_supported())
+    // Draws and tests the next block of hardware words, RDRAND first and RDSEED when it has
+    // nothing. Returns false if no word was available or the block failed a health test.
+    [[nodiscard]] bool refill_hw() noexcept
+    {
+        if (hardware_health.disabled.load(std::memory_order_relaxed))
         {
-            std::uint64_t v1 = hardware_rng::rdrand();
-            std::uint64_t v2 = hardware_rng::rdrand();
+            use_hw_rng_ = false;
+            return false;
+        }
 
-            if (v1 != 0 || v2 != 0)
+        for (std::uint64_t& word : hw_block_)
+        {
+            if (hardware_rng::rdrand(word))
+            {
+                continue;
+            }
+            UUIDS_PROBE(rdrand_failure);
+            if (!hardware_rng::rdseed(word))
             {
-                std::memcpy(uuid_span.data(), &v1, 8);
-                std::memcpy(uuid_span.subspan(8).data(), &v2, 8);
-                used_hw_rng = true;
+                UUIDS_PROBE(rdseed_failure);
+                hardware_health.unavailable.fetch_add(1, std::memory_order_relaxed);
+                return false;
             }
         }
+        hardware_health.blocks.fetch_add(1, std::memory_order_relaxed);
 
-        if (!used_hw_rng && hardware_rng::rdseed_supported())
+        const auto verdict = health_.test(hw_block_);
+        if (verdict != entropy_health_test::verdict::pass)
         {
-            std::uint64_t v1 = hardware_rng::rdseed();
-            std::uint64_t v2 = hardware_rng::rdseed();
-
-            if (v1 != 0 || v2 != 0)
-            {
-                std::memcpy(uuid_span.data(), &v1, 8);
-                std::memcpy(uuid_span.subspan(8).data(), &v2, 8);
-                used_hw_rng = true;
-            }
+            auto& failures = verdict == entropy_health_test::verdict::repetition
+                                 ? hardware_health.repetition_failures
+                                 : hardware_health.proportion_failures;
+            failures.fetch_add(1, std::memory_order_relaxed);
+            hardware_health.disabled.store(true, std::memory_order_relaxed);
+            UUIDS_PROBE1(health_failure, static_cast<int>(verdict));
+            use_hw_rng_ = false;
+            return false;
         }
 
-        if (!used_hw_rng)
+        hw_next_ = 0;
+        return true;
+    }
+
+    [[nodiscard]] result_type generate_hw() noexcept
+    {
+        if (hw_next_ == hw_block_.size() && !refill_hw())
         {
+            UUIDS_PROBE(software_fallback);
             return generate_sw();
         }
 
+        uuid_bytes uuid;
+        std::memcpy(uuid.data.data(), &hw_block_[hw_next_], 16);
+        hw_next_ += 2;
+
 #if defined(__x86_64__) || defined(_M_X64)
         if (hardware_rng::aesni_supported() && simd::compile_time::has<simd::Feature::AES>())
         {
@@ -245,6 +399,11 @@ private:
 
     PRNG rng_;
     bool use_hw_rng_;
+    bool entropy_seeded_;
+    std::uint64_t generation_{fork_generation()};
+    entropy_health_test health_;
+    std::array<std::uint64_t, entropy_health_test::block_words> hw_block_{};
+    std::size_t hw_next_{entropy_health_test::block_words};
 
     static_assert(std::is_trivially_copyable_v<PRNG>);
     static_assert(std::is_trivially_destructible_v<PRNG>);
@@ -252,61 +411,15 @@ private:
 
 } // namespace detail
 
+// Generators of every engine return the same uuid; the alias remains for existing code.
 template <typename PRNG = std::mt19937_64>
-class basic_uuid final
-{
-public:
-    using bytes_type = std::array<std::uint8_t, 16>;
-
-    static constexpr std::size_t size() noexcept { return 16; }
-
-    constexpr basic_uuid() noexcept = default;
-
-    explicit constexpr basic_uuid(const bytes_type& bytes) noexcept : data_{bytes} {}
-
-    explicit constexpr basic_uuid(std::span<const std::uint8_t, 16> bytes) noexcept : data_{bytes}
-    {
-    }
-
-    explicit constexpr basic_uuid(detail::uuid_bytes bytes) noexcept : data_{std::move(bytes)} {}
-
-    [[nodiscard]] constexpr const bytes_type& bytes() const noexcept { return data_.data; }
-
-    [[nodiscard]] constexpr std::span<const std::uint8_t, 16> span() const noexcept
-    {
-        return std::span<const std::uint8_t, 16>(data_.data);
-    }
-
-    [[nodiscard]] std::string str() const
-    {
-        static constexpr std::string_view hex = "0123456789abcdef";
-        std::string result(36, '\0');
-
-        std::size_t i = 0;
-        for (std::size_t j = 0; j < 16; ++j)
-        {
-            if (j == 4 || j == 6 || j == 8 || j == 10)
-            {
-                result[i++] = '-';
-            }
-            result[i++] = hex[data_.data[j] >> 4];
-            result[i++] = hex[data_.data[j] & 0x0F];
-        }
-
-        return result;
-    }
-
-    [[nodiscard]] constexpr auto operator<=>(const basic_uuid&) const noexcept = default;
-
-private:
-    detail::uuid_bytes data_{};
-};
+using basic_uuid = uuid;
 
 template <typename PRNG = std::mt19937_64>
 class basic_uuid_generator final
 {
 public:
-    using uuid_type = basic_uuid<PRNG>;
+    using uuid_type = uuid;
     using result_type = detail::uuid_bytes;
 
     constexpr basic_uuid_generator() noexcept = default;
@@ -321,49 +434,32 @@ private:
     detail::optimized_generator<PRNG> gen_;
 };
 
-using uuid = basic_uuid<>;
 using uuid_generator = basic_uuid_generator<>;
 
-template <typename CharT, typename Traits, typename PRNG>
-inline std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os,
-                                                     const basic_uuid<PRNG>& uuid)
+struct hardware_entropy_stats final
 {
-    return os << uuid.str();
-}
-
-} // namespace uuids::inline v1
+    std::uint64_t blocks_tested;        // blocks of raw hardware words that were health-tested
+    std::uint64_t unavailable;          // times neither RDRAND nor RDSEED returned a value
+    std::uint64_t repetition_failures;  // blocks failing the repetition count test
+    std::uint64_t proportion_failures;  // blocks failing the adaptive proportion test
+    bool disabled;                      // a test failed; generators now use their own engine
+};
 
-namespace std
+// Counts for the whole process; v4 generators record into them as they draw hardware words.
+[[nodiscard]] inline hardware_entropy_stats hardware_entropy_status() noexcept
 {
+    const auto& health = detail::hardware_health;
+    return {health.blocks.load(std::memory_order_relaxed),
+            health.unavailable.load(std::memory_order_relaxed),
+            health.repetition_failures.load(std::memory_order_relaxed),
+            health.proportion_failures.load(std::memory_order_relaxed),
+            health.disabled.load(std::memory_order_relaxed)};
+}
 
-template <typename PRNG>
-struct hash<uuids::basic_uuid<PRNG>>
-{
-    [[nodiscard]] std::size_t operator()(const uuids::basic_uuid<PRNG>& uuid) const noexcept
-    {
-        const auto& bytes = uuid.bytes();
-        if constexpr (sizeof(std::size_t) == 8)
-        {
-            std::uint64_t h1, h2;
-            std::memcpy(&h1, bytes.data(), 8);
-            std::memcpy(&h2, bytes.data() + 8, 8);
-            return h1 ^ (h2 + 0x9e3779b97f4a7c15ULL + (h1 << 6) + (h1 >> 2));
-        }
-        else
-        {
-            std::uint32_t h = 0;
-            for (std::size_t i = 0; i < 16; i += 4)
-            {
-                std::uint32_t k;
-                std::memcpy(&k, bytes.data() + i, 4);
-                h ^= k;
-                h *= 0x1b873593U;
-            }
-            return h;
-        }
-    }
-};
+// Draws from health-tested RDRAND where available and otherwise from the kernel CSPRNG, never
+// from a user-space PRNG.
+using secure_uuid_generator = basic_uuid_generator<os_entropy_engine>;
 
-} // namespace std
+} // namespace uuids::inline v1
 
-#endif /* End of include guard: UUIDV4_HPP_xir2zk */
\ No newline at end of file
+#endif /* End of include guard: UUIDV4_HPP_xir2zk */
@@ -0,0 +1,183 @@
+#ifndef UUIDV7_HPP_k4t9wq
+#define UUIDV7_HPP_k4t9wq
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <span>
+
+#include <uuids/clock.hpp>
+#include <uuids/probes.hpp>
+#include <uuids/uuidv4.hpp>
+
+namespace uuids::inline v1
+{
+
+namespace detail
+{
+
+struct v7_layout final
+{
+    static constexpr unsigned counter_bits = 16;
+    static constexpr std::uint64_t counter_mask = (std::uint64_t{1} << counter_bits) - 1;
+
+    [[nodiscard]] static constexpr std::uint64_t tick(std::uint64_t unix_ms,
+                                                      std::uint64_t counter = 0) noexcept
+    {
+        return (unix_ms << counter_bits) | (counter & counter_mask);
+    }
+
+    // The 16-bit counter fills rand_a and the four leading bits of rand_b (RFC 9562 6.2,
+    // method 1); the remaining 58 bits of rand_b keep whatever the random source produced.
+    static constexpr void encode(uuid_bytes& bytes, std::uint64_t tick) noexcept
+    {
+        const std::uint64_t unix_ms = tick >> counter_bits;
+        const auto counter = static_cast<std::uint32_t>(tick & counter_mask);
+
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            bytes.data[i] = static_cast<std::uint8_t>(unix_ms >> (40 - 8 * i));
+        }
+
+        bytes.data[6] = static_cast<std::uint8_t>(0x70 | (counter >> 12));
+        bytes.data[7] = static_cast<std::uint8_t>(counter >> 4);
+        bytes.data[8] =
+            static_cast<std::uint8_t>(0x80 | ((counter & 0x0F) << 2) | (bytes.data[8] & 0x03));
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t decode_tick(const uuid_bytes& bytes) noexcept
+    {
+        std::uint64_t unix_ms = 0;
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            unix_ms = (unix_ms << 8) | bytes.data[i];
+        }
+
+        const std::uint64_t counter = (std::uint64_t{bytes.data[6] & 0x0Fu} << 12) |
+                                      (std::uint64_t{bytes.data[7]} << 4) |
+                                      ((bytes.data[8] >> 2) & 0x0Fu);
+        return tick(unix_ms, counter);
+    }
+};
+
+// Next free v7 tick. One CAS claims [first, first + count); the state never moves backwards, so
+// a clock step back keeps counting from the last tick and a counter overflow carries into the
+// timestamp.
+class monotonic_ticks final
+{
+public:
+    constexpr monotonic_ticks() noexcept = default;
+
+    [[nodiscard]] std::uint64_t reserve(std::uint64_t count, std::uint64_t floor) noexcept
+    {
+        std::uint64_t current = next_.load(std::memory_order_relaxed);
+        std::uint64_t first = 0;
+
+        do
+        {
+            first = std::max(current, floor);
+        } while (!next_.compare_exchange_weak(current, first + count, std::memory_order_acq_rel,
+                                              std::memory_order_relaxed));
+
+        return first;
+    }
+
+    void advance_past(std::uint64_t tick) noexcept
+    {
+        std::uint64_t current = next_.load(std::memory_order_relaxed);
+        while (current <= tick &&
+               !next_.compare_exchange_weak(current, tick + 1, std::memory_order_acq_rel,
+                                            std::memory_order_relaxed))
+        {
+        }
+    }
+
+    [[nodiscard]] std::uint64_t next() const noexcept
+    {
+        return next_.load(std::memory_order_acquire);
+    }
+
+private:
+    alignas(64) std::atomic<std::uint64_t> next_{0};
+};
+
+template <typename PRNG>
+[[nodiscard]] uuid make_v7(std::uint64_t tick) noexcept
+{
+    thread_local optimized_generator<PRNG> random;
+
+    uuid_bytes bytes = random();
+    v7_layout::encode(bytes, tick);
+    return uuid(bytes);
+}
+
+// The generation path shared by every v7 generator that draws ticks from one monotonic_ticks;
+// derived generators only add how foreign ticks are folded in.
+template <typename PRNG, ClockSource Clock>
+class v7_sequence
+{
+public:
+    using uuid_type = uuid;
+
+    v7_sequence(const v7_sequence&) = delete;
+    v7_sequence& operator=(const v7_sequence&) = delete;
+
+    [[nodiscard]] uuid_type operator()() noexcept
+    {
+        return make_v7<PRNG>(ticks_.reserve(1, floor()));
+    }
+
+    void generate(std::span<uuid_type> out) noexcept
+    {
+        if (out.empty())
+        {
+            return;
+        }
+
+        std::uint64_t tick = ticks_.reserve(out.size(), floor());
+        UUIDS_PROBE1(v7_batch, out.size());
+        for (auto& id : out)
+        {
+            id = make_v7<PRNG>(tick++);
+        }
+    }
+
+    [[nodiscard]] std::uint64_t last_tick() const noexcept { return ticks_.next() - 1; }
+
+protected:
+    constexpr v7_sequence() noexcept = default;
+    ~v7_sequence() = default;
+
+    [[nodiscard]] static std::uint64_t floor() noexcept
+    {
+        return v7_layout::tick(Clock::unix_ms());
+    }
+
+    monotonic_ticks ticks_;
+};
+
+} // namespace detail
+
+template <typename PRNG = std::mt19937_64, ClockSource Clock = system_clock_source>
+class basic_shared_uuid_v7_generator final : public detail::v7_sequence<PRNG, Clock>
+{
+public:
+    constexpr basic_shared_uuid_v7_generator() noexcept = default;
+
+    basic_shared_uuid_v7_generator(const basic_shared_uuid_v7_generator&) = delete;
+    basic_shared_uuid_v7_generator& operator=(const basic_shared_uuid_v7_generator&) = delete;
+
+    // One instance per linked module: a shared libuuids (and so uuids_generate_v7) has its own.
+    [[nodiscard]] static basic_shared_uuid_v7_generator& global() noexcept
+    {
+        static basic_shared_uuid_v7_generator instance;
+        return instance;
+    }
+};
+
+using shared_uuid_v7_generator = basic_shared_uuid_v7_generator<>;
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: UUIDV7_HPP_k4t9wq */
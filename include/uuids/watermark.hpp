@@ -0,0 +1,259 @@
+#ifndef WATERMARK_HPP_w3n6ks
+#define WATERMARK_HPP_w3n6ks
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "uuids/watermark.hpp requires POSIX mmap/msync"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <span>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <uuids/uuidv7.hpp>
+
+namespace uuids::inline v1
+{
+
+namespace detail
+{
+
+struct watermark_record final
+{
+    static constexpr std::uint64_t magic_value = 0x75756964'776d6b31ULL;
+
+    std::uint64_t magic;
+    std::uint64_t boundary;
+    std::uint64_t check;
+};
+
+} // namespace detail
+
+// A single durable word: the first v7 tick that has *not* been reserved yet. The record sits at
+// the start of one mmapped page, so persisting it is a store plus one msync. An exclusive flock
+// keeps a second owner, in this process or another, from writing back a lower boundary.
+class v7_watermark_file final
+{
+public:
+    explicit v7_watermark_file(const std::string& path)
+        : fd_{::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600)}
+    {
+        const bool created = fd_ >= 0;
+        if (!created && errno == EEXIST)
+        {
+            fd_ = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+        }
+        if (fd_ < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "open " + path);
+        }
+
+        if (::flock(fd_, LOCK_EX | LOCK_NB) != 0)
+        {
+            fail("watermark file " + path + " is in use");
+        }
+
+        struct stat info{};
+        if (::fstat(fd_, &info) != 0 ||
+            (static_cast<std::size_t>(info.st_size) < page_size &&
+             ::ftruncate(fd_, static_cast<off_t>(page_size)) != 0))
+        {
+            fail("watermark file size");
+        }
+
+        // A new file must survive a crash itself, not only its contents.
+        if (created && (::fsync(fd_) != 0 || !sync_directory_of(path)))
+        {
+            fail("sync new watermark file " + path);
+        }
+
+        void* memory = ::mmap(nullptr, page_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (memory == MAP_FAILED)
+        {
+            fail("mmap watermark file");
+        }
+        record_ = static_cast<detail::watermark_record*>(memory);
+
+        const bool fresh = record_->magic == 0 && record_->boundary == 0;
+        if (!fresh && (record_->magic != detail::watermark_record::magic_value ||
+                       record_->check != ~record_->boundary))
+        {
+            ::munmap(record_, page_size);
+            record_ = nullptr;
+            errno = EILSEQ;
+            fail("corrupt watermark file " + path);
+        }
+    }
+
+    v7_watermark_file(const v7_watermark_file&) = delete;
+    v7_watermark_file& operator=(const v7_watermark_file&) = delete;
+
+    ~v7_watermark_file()
+    {
+        if (record_ != nullptr)
+        {
+            ::munmap(record_, page_size);
+        }
+        ::close(fd_);
+    }
+
+    [[nodiscard]] std::uint64_t boundary() const noexcept { return record_->boundary; }
+
+    [[nodiscard]] std::uint64_t sync_count() const noexcept { return syncs_; }
+
+    void persist(std::uint64_t boundary)
+    {
+        record_->boundary = boundary;
+        record_->check = ~boundary;
+        record_->magic = detail::watermark_record::magic_value;
+
+        if (::msync(record_, page_size, MS_SYNC) != 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "msync watermark file");
+        }
+        ++syncs_;
+    }
+
+private:
+    static constexpr std::size_t page_size = 4096;
+
+    [[nodiscard]] static bool sync_directory_of(const std::string& path) noexcept
+    {
+        const std::size_t slash = path.find_last_of('/');
+        const std::string directory = slash == std::string::npos ? "."
+                                      : slash == 0             ? "/"
+                                                               : path.substr(0, slash);
+        const int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return false;
+        }
+        const bool synced = ::fsync(fd) == 0;
+        ::close(fd);
+        return synced;
+    }
+
+    [[noreturn]] void fail(const std::string& what)
+    {
+        const int error = errno;
+        ::close(fd_);
+        throw std::system_error(error, std::generic_category(), what);
+    }
+
+    int fd_;
+    detail::watermark_record* record_{nullptr};
+    std::uint64_t syncs_{0};
+};
+
+// v7 generator that never issues a tick at or above the durable watermark. When a reservation
+// would cross it, the watermark is pushed to now + window and synced before any ID of the
+// reservation is returned; on restart generation resumes at the recorded boundary, so neither a
+// crash nor a clock stepped backwards can reissue or regress IDs. Cost: one sync per window.
+template <typename PRNG = std::mt19937_64, ClockSource Clock = system_clock_source>
+class basic_persistent_uuid_v7_generator final
+{
+public:
+    using uuid_type = uuid;
+
+    static constexpr std::chrono::milliseconds default_window{std::chrono::seconds(10)};
+
+    explicit basic_persistent_uuid_v7_generator(const std::string& path,
+                                                std::chrono::milliseconds window = default_window)
+        : file_{path}, window_ticks_{window_to_ticks(window)}, limit_{file_.boundary()}
+    {
+        if (limit_ != 0)
+        {
+            ticks_.advance_past(limit_ - 1);
+        }
+    }
+
+    basic_persistent_uuid_v7_generator(const basic_persistent_uuid_v7_generator&) = delete;
+    basic_persistent_uuid_v7_generator& operator=(const basic_persistent_uuid_v7_generator&) =
+        delete;
+
+    [[nodiscard]] uuid_type operator()() { return detail::make_v7<PRNG>(reserve(1)); }
+
+    void generate(std::span<uuid_type> out)
+    {
+        if (out.empty())
+        {
+            return;
+        }
+
+        std::uint64_t tick = reserve(out.size());
+        for (auto& id : out)
+        {
+            id = detail::make_v7<PRNG>(tick++);
+        }
+    }
+
+    [[nodiscard]] std::uint64_t durable_limit() const noexcept
+    {
+        return limit_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] std::uint64_t sync_count() const
+    {
+        std::lock_guard lock(mutex_);
+        return file_.sync_count();
+    }
+
+private:
+    [[nodiscard]] std::uint64_t reserve(std::uint64_t count)
+    {
+        const std::uint64_t first = ticks_.reserve(count, floor());
+        if (first + count > limit_.load(std::memory_order_acquire))
+        {
+            extend(first + count);
+        }
+        return first;
+    }
+
+    void extend(std::uint64_t required)
+    {
+        std::lock_guard lock(mutex_);
+        if (required <= limit_.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        const std::uint64_t boundary = std::max(required, floor() + window_ticks_);
+        file_.persist(boundary);
+        limit_.store(boundary, std::memory_order_release);
+    }
+
+    [[nodiscard]] static std::uint64_t floor() noexcept
+    {
+        return detail::v7_layout::tick(Clock::unix_ms());
+    }
+
+    [[nodiscard]] static std::uint64_t window_to_ticks(std::chrono::milliseconds window) noexcept
+    {
+        const auto ms = std::max<std::chrono::milliseconds::rep>(window.count(), 1);
+        return detail::v7_layout::tick(static_cast<std::uint64_t>(ms));
+    }
+
+    v7_watermark_file file_;
+    std::uint64_t window_ticks_;
+    detail::monotonic_ticks ticks_;
+    std::atomic<std::uint64_t> limit_;
+    mutable std::mutex mutex_;
+};
+
+using persistent_uuid_v7_generator = basic_persistent_uuid_v7_generator<>;
+
+} // namespace uuids::inline v1
+
+#endif /* End of include guard: WATERMARK_HPP_w3n6ks */
@@ -0,0 +1,108 @@
+// The uuids library as a C++20 named module: `import uuids;` replaces the individual headers.
+// The headers stay the source of truth; this unit only re-exports their public names. The
+// POSIX-only persistence headers (uuids/watermark.hpp, uuids/shm_lease.hpp) are not part of it.
+module;
+
+#include <uuids/arrow.hpp>
+#include <uuids/atomic_uuid.hpp>
+#include <uuids/binlog.hpp>
+#include <uuids/bulk.hpp>
+#include <uuids/clock.hpp>
+#include <uuids/entropy.hpp>
+#include <uuids/hlc.hpp>
+#include <uuids/snowflake.hpp>
+#include <uuids/trace.hpp>
+#include <uuids/uuid.hpp>
+#include <uuids/uuid_map.hpp>
+#include <uuids/uuidv4.hpp>
+#include <uuids/uuidv7.hpp>
+
+export module uuids;
+
+export namespace uuids
+{
+
+// uuids/uuid.hpp
+using uuids::hash_value;
+using uuids::operator<<;
+using uuids::uuid;
+using uuids::uuid_equal;
+
+// uuids/uuidv4.hpp, uuids/uuidv7.hpp, uuids/hlc.hpp
+using uuids::basic_hlc_uuid_generator;
+using uuids::basic_shared_uuid_v7_generator;
+using uuids::basic_uuid;
+using uuids::basic_uuid_generator;
+using uuids::hardware_entropy_stats;
+using uuids::hardware_entropy_status;
+using uuids::hlc_uuid_generator;
+using uuids::secure_uuid_generator;
+using uuids::shared_uuid_v7_generator;
+using uuids::uuid_generator;
+
+// uuids/clock.hpp
+using uuids::cached_clock_source;
+using uuids::ClockSource;
+using uuids::coarse_clock_source;
+using uuids::system_clock_source;
+using uuids::tsc_clock_source;
+
+// uuids/entropy.hpp
+using uuids::fresh_seed;
+using uuids::os_entropy_engine;
+using uuids::seed256;
+using uuids::seeded_engine;
+
+// uuids/snowflake.hpp
+using uuids::basic_snowflake;
+using uuids::snowflake;
+using uuids::snowflake_generator;
+using uuids::SnowflakeLayout;
+using uuids::twitter_snowflake_layout;
+
+// uuids/atomic_uuid.hpp, uuids/bulk.hpp, uuids/uuid_map.hpp
+using uuids::atomic_uuid;
+using uuids::basic_atomic_uuid;
+using uuids::extract_timestamps;
+using uuids::filter_time_range;
+using uuids::hash_many;
+using uuids::rfc9562_versions;
+using uuids::uuid_map;
+using uuids::uuid_set;
+using uuids::validate_many;
+using uuids::version_bit;
+using uuids::version_histogram;
+
+// uuids/arrow.hpp
+using uuids::arrow_uuid_column;
+using uuids::arrow_uuid_view;
+using uuids::generate_arrow_column;
+using uuids::parse_arrow_column;
+
+// uuids/trace.hpp
+using uuids::basic_trace_id_generator;
+using uuids::format_traceparent;
+using uuids::parse_traceparent;
+using uuids::span_id;
+using uuids::to_traceparent;
+using uuids::trace_context;
+using uuids::trace_id;
+using uuids::trace_id_generator;
+using uuids::trace_sampler;
+using uuids::traceparent_size;
+
+namespace trace_flags
+{
+using uuids::trace_flags::random_trace_id;
+using uuids::trace_flags::sampled;
+} // namespace trace_flags
+
+// uuids/binlog.hpp
+using uuids::binary_log;
+using uuids::format_log_record;
+using uuids::log_field;
+using uuids::log_record;
+using uuids::log_ring;
+using uuids::visit_log_record;
+
+} // namespace uuids
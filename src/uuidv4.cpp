@@ -0,0 +1,112 @@
+#include <uuids/uuids.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <new>
+#include <span>
+#include <string_view>
+
+#include <uuids/bulk.hpp>
+#include <uuids/probes.hpp>
+#include <uuids/uuidv4.hpp>
+#include <uuids/uuidv7.hpp>
+
+struct uuids_generator final
+{
+    uuids::uuid_generator generator;
+};
+
+namespace
+{
+
+constexpr std::size_t id_size = 16;
+
+void generate_v4(uuids::uuid_generator& generator, std::uint8_t* out, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const uuids::uuid id = generator();
+        std::memcpy(out + id_size * i, id.bytes().data(), id_size);
+    }
+}
+
+} // namespace
+
+extern "C"
+{
+
+std::uint32_t uuids_abi_version(void)
+{
+    return UUIDS_ABI_VERSION;
+}
+
+void uuids_generate_v4(std::uint8_t* out, std::size_t n)
+{
+    thread_local uuids::uuid_generator generator;
+    generate_v4(generator, out, n);
+}
+
+void uuids_generate_v7(std::uint8_t* out, std::size_t n)
+{
+    // Generated in chunks so each chunk costs a single tick reservation.
+    std::array<uuids::uuid, 256> chunk;
+    while (n != 0)
+    {
+        const std::size_t count = std::min(n, chunk.size());
+        uuids::shared_uuid_v7_generator::global().generate(std::span(chunk.data(), count));
+        std::memcpy(out, chunk.data(), id_size * count);
+        out += id_size * count;
+        n -= count;
+    }
+}
+
+void uuids_format_many(const std::uint8_t* in, std::size_t n, char* out)
+{
+    UUIDS_PROBE1(format_batch, n);
+    std::array<std::uint8_t, id_size> bytes;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::memcpy(bytes.data(), in + id_size * i, id_size);
+        uuids::detail::format_uuid(bytes, out + UUIDS_TEXT_SIZE * i);
+    }
+}
+
+std::size_t uuids_parse_many(const char* in, std::size_t n, std::uint8_t* out)
+{
+    std::array<std::uint8_t, id_size> bytes;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (!uuids::detail::parse_uuid(std::string_view(in + UUIDS_TEXT_SIZE * i, UUIDS_TEXT_SIZE),
+                                       bytes))
+        {
+            UUIDS_PROBE2(parse_batch, n, i);
+            return i;
+        }
+        std::memcpy(out + id_size * i, bytes.data(), id_size);
+    }
+    UUIDS_PROBE2(parse_batch, n, n);
+    return n;
+}
+
+void uuids_hash_many(const std::uint8_t* in, std::size_t n, std::uint64_t* out)
+{
+    uuids::detail::hash_many_bytes(in, n, 0, out);
+}
+
+uuids_generator* uuids_generator_new(void)
+{
+    return new (std::nothrow) uuids_generator{};
+}
+
+void uuids_generator_free(uuids_generator* generator)
+{
+    delete generator;
+}
+
+void uuids_generator_v4(uuids_generator* generator, std::uint8_t* out, std::size_t n)
+{
+    generate_v4(generator->generator, out, n);
+}
+
+} // extern "C"
@@ -0,0 +1,144 @@
+#include <uuids/arrow.hpp>
+#include <uuids/uuidv4.hpp>
+#include <uuids/uuidv7.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST(Arrow, ViewBorrowsValuesAndValidity)
+{
+    alignas(64) std::uint8_t values[16 * 10] = {};
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        values[16 * i + 15] = static_cast<std::uint8_t>(i);
+    }
+    // Slots 3 and 8 are null.
+    const std::uint8_t validity[2] = {0xF7, 0xFE};
+
+    const uuids::arrow_uuid_view view(values, validity, 8, 2);
+    ASSERT_EQ(view.size(), 8u);
+    EXPECT_EQ(static_cast<const void*>(view.ids().data()), values + 32);
+    EXPECT_EQ(view.ids()[0].bytes()[15], 2);
+    EXPECT_EQ(view.null_count(), 2u);
+    EXPECT_FALSE(view.is_valid(1));
+    EXPECT_FALSE(view[6].has_value());
+    ASSERT_TRUE(view[7].has_value());
+    EXPECT_EQ(view[7]->bytes()[15], 9);
+
+    const uuids::arrow_uuid_view dense(values, nullptr, 10);
+    EXPECT_EQ(dense.null_count(), 0u);
+    EXPECT_TRUE(dense.is_valid(3));
+
+    EXPECT_THROW(uuids::arrow_uuid_view(values + 8, nullptr, 1), std::invalid_argument);
+}
+
+TEST(Arrow, GeneratedColumnsAreAlignedAndPadded)
+{
+    uuids::uuid_generator v4;
+    const auto random = uuids::generate_arrow_column(v4, 1000);
+    ASSERT_EQ(random.size(), 1000u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(random.values_buffer().data()) % 64, 0u);
+    EXPECT_EQ(random.values_buffer().size(), 16000u);
+    EXPECT_TRUE(random.validity_buffer().empty());
+    for (const auto& id : random.ids())
+    {
+        EXPECT_EQ(id.version(), 4);
+    }
+
+    uuids::shared_uuid_v7_generator v7;
+    const auto ordered = uuids::generate_arrow_column(v7, 3);
+    EXPECT_EQ(ordered.values_buffer().size(), 64u);
+    EXPECT_LT(ordered.ids()[0], ordered.ids()[1]);
+    EXPECT_LT(ordered.ids()[1], ordered.ids()[2]);
+    for (std::size_t i = 48; i < 64; ++i)
+    {
+        EXPECT_EQ(ordered.values_buffer()[i], std::byte{0});
+    }
+}
+
+TEST(Arrow, ParseTurnsMalformedTextIntoNulls)
+{
+    const std::vector<std::string_view> texts{"017f22e2-79b0-7cc3-98c4-dc0c0c07398f",
+                                              "not a uuid",
+                                              "017f22e279b07cc398c4dc0c0c07398f"};
+    const auto column = uuids::parse_arrow_column(texts);
+    EXPECT_EQ(column.null_count(), 1u);
+    EXPECT_TRUE(column.is_valid(0));
+    EXPECT_FALSE(column.is_valid(1));
+    EXPECT_EQ(column.ids()[0], column.ids()[2]);
+    EXPECT_EQ(column.ids()[1], uuids::uuid());
+    ASSERT_EQ(column.validity_buffer().size(), 64u);
+    EXPECT_EQ(column.validity_buffer()[0], std::byte{0x05});
+
+    const auto view = column.view();
+    EXPECT_EQ(view.null_count(), 1u);
+    EXPECT_EQ(view[0]->str(), "017f22e2-79b0-7cc3-98c4-dc0c0c07398f");
+}
+
+TEST(Arrow, ParseUtf8ArrayHonoursOffsetAndNulls)
+{
+    const std::string data = "skipped"
+                             "017f22e2-79b0-7cc3-98c4-dc0c0c07398f"
+                             "017f22e2-79b0-7cc3-98c4-dc0c0c07398f"
+                             "bad";
+    const std::int32_t offsets[] = {0, 7, 43, 79, 82};
+    // Slot 2 is null even though its text parses.
+    const std::uint8_t validity[] = {0x0B};
+
+    const auto column = uuids::parse_arrow_column(offsets, data.data(), validity, 3, 1);
+    ASSERT_EQ(column.size(), 3u);
+    EXPECT_EQ(column.null_count(), 2u);
+    EXPECT_TRUE(column.is_valid(0));
+    EXPECT_FALSE(column.is_valid(1));
+    EXPECT_FALSE(column.is_valid(2));
+    EXPECT_EQ(column.ids()[0].version(), 7);
+
+    const std::int64_t large_offsets[] = {7, 43};
+    const auto large = uuids::parse_arrow_column(large_offsets, data.data(), nullptr, 1);
+    EXPECT_EQ(large.null_count(), 0u);
+    EXPECT_EQ(large.ids()[0], column.ids()[0]);
+}
+
+TEST(Arrow, ColumnsAllocateFromTheGivenResource)
+{
+    std::vector<std::byte> buffer(1 << 14);
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+
+    const std::vector<std::string_view> texts{"017f22e2-79b0-7cc3-98c4-dc0c0c07398f", "bad"};
+    const auto column = uuids::parse_arrow_column(texts, &arena);
+    EXPECT_EQ(column.resource(), &arena);
+    EXPECT_EQ(column.null_count(), 1u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(column.validity_buffer().data()) % 64, 0u);
+
+    const auto* begin = buffer.data();
+    const auto* values = column.values_buffer().data();
+    EXPECT_TRUE(values >= begin && values < begin + buffer.size());
+}
+
+TEST(Arrow, MovedFromColumnIsEmpty)
+{
+    const std::vector<std::string_view> texts{"017f22e2-79b0-7cc3-98c4-dc0c0c07398f", "bad"};
+    auto column = uuids::parse_arrow_column(texts);
+
+    auto moved = std::move(column);
+    EXPECT_EQ(moved.size(), 2u);
+    EXPECT_EQ(moved.null_count(), 1u);
+    EXPECT_EQ(column.size(), 0u);
+    EXPECT_EQ(column.null_count(), 0u);
+    EXPECT_TRUE(column.ids().empty());
+    EXPECT_TRUE(column.view().empty());
+
+    uuids::arrow_uuid_column assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.size(), 2u);
+    EXPECT_EQ(assigned.null_count(), 1u);
+    EXPECT_EQ(moved.size(), 0u);
+    EXPECT_EQ(moved.null_count(), 0u);
+}
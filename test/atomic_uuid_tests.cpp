@@ -0,0 +1,86 @@
+#include <uuids/atomic_uuid.hpp>
+#include <gtest/gtest.h>
+
+#include <set>
+#include <thread>
+#include <vector>
+
+TEST(AtomicUUID, DefaultIsNil)
+{
+    uuids::atomic_uuid value;
+    EXPECT_EQ(value.load(), uuids::uuid{});
+}
+
+TEST(AtomicUUID, StoreLoadExchange)
+{
+    uuids::uuid_generator gen;
+    const auto a = gen();
+    const auto b = gen();
+
+    uuids::atomic_uuid value(a);
+    EXPECT_EQ(value.load(), a);
+
+    value.store(b);
+    EXPECT_EQ(value.load(), b);
+
+    EXPECT_EQ(value.exchange(a), b);
+    EXPECT_EQ(value.load(), a);
+}
+
+TEST(AtomicUUID, CompareExchangeReportsCurrentValue)
+{
+    uuids::uuid_generator gen;
+    const auto a = gen();
+    const auto b = gen();
+    const auto c = gen();
+
+    uuids::atomic_uuid value(a);
+
+    auto expected = b;
+    EXPECT_FALSE(value.compare_exchange_strong(expected, c));
+    EXPECT_EQ(expected, a);
+
+    EXPECT_TRUE(value.compare_exchange_strong(expected, c));
+    EXPECT_EQ(value.load(), c);
+}
+
+TEST(AtomicUUID, ConcurrentExchangeNeverTears)
+{
+    constexpr int threads = 4;
+    constexpr int iterations = 20000;
+
+    uuids::uuid_generator gen;
+    std::vector<uuids::uuid> values;
+    for (int i = 0; i < threads; ++i)
+    {
+        values.push_back(gen());
+    }
+
+    uuids::atomic_uuid shared(values[0]);
+    const std::set<uuids::uuid> known(values.begin(), values.end());
+    std::atomic<bool> torn{false};
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back(
+            [&, t]()
+            {
+                for (int i = 0; i < iterations; ++i)
+                {
+                    if (known.count(shared.exchange(values[static_cast<std::size_t>(t)])) == 0 ||
+                        known.count(shared.load()) == 0)
+                    {
+                        torn.store(true);
+                    }
+                }
+            });
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    EXPECT_FALSE(torn.load());
+}
@@ -0,0 +1,118 @@
+#include <uuids/binlog.hpp>
+#include <uuids/uuidv4.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(BinaryLog, RoundTripsFields)
+{
+    const auto id = uuids::uuid_generator{}();
+    uuids::log_record record;
+    record.add(id).add(std::uint64_t{42}).add(-7).add("request done");
+    EXPECT_FALSE(record.truncated());
+    EXPECT_EQ(record.bytes().size(), 17u + 9u + 9u + 3u + 12u);
+
+    std::string text;
+    ASSERT_TRUE(uuids::format_log_record(record.bytes(), text));
+    EXPECT_EQ(text, id.str() + " 42 -7 request done");
+}
+
+TEST(BinaryLog, OversizedFieldIsDroppedNotSplit)
+{
+    uuids::log_record record;
+    record.add(std::string(300, 'x')).add(1u);
+    EXPECT_TRUE(record.truncated());
+
+    std::string text;
+    ASSERT_TRUE(uuids::format_log_record(record.bytes(), text));
+    EXPECT_EQ(text, "1");
+}
+
+TEST(BinaryLog, RejectsMalformedRecords)
+{
+    const std::byte unknown_tag[] = {std::byte{0x7F}};
+    const std::byte short_uuid[] = {std::byte{1}, std::byte{0}, std::byte{0}};
+    std::string text;
+    EXPECT_FALSE(uuids::format_log_record(unknown_tag, text));
+    EXPECT_FALSE(uuids::format_log_record(short_uuid, text));
+}
+
+TEST(BinaryLog, DrainsEveryThreadInOrder)
+{
+    uuids::binary_log log;
+    constexpr int per_thread = 500;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&log, t]()
+            {
+                for (int i = 0; i < per_thread; ++i)
+                {
+                    uuids::log_record record;
+                    record.add(t).add(i);
+                    EXPECT_TRUE(log.write(record));
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<int> next(4, 0);
+    const std::size_t drained = log.drain(
+        [&](std::span<const std::byte> record)
+        {
+            std::vector<std::int64_t> values;
+            uuids::visit_log_record(record,
+                                    [&](uuids::log_field, std::span<const std::byte> payload)
+                                    {
+                                        std::int64_t value = 0;
+                                        std::memcpy(&value, payload.data(), sizeof(value));
+                                        values.push_back(value);
+                                    });
+            ASSERT_EQ(values.size(), 2u);
+            EXPECT_EQ(values[1], next[static_cast<std::size_t>(values[0])]++);
+        });
+    EXPECT_EQ(drained, 4u * per_thread);
+    EXPECT_EQ(log.drain([](auto) {}), 0u);
+    EXPECT_EQ(log.dropped(), 0u);
+}
+
+TEST(BinaryLog, FullRingCountsDrops)
+{
+    uuids::log_ring ring(0);
+    uuids::log_record record;
+    record.add(std::string(200, 'x'));
+
+    int written = 0;
+    while (ring.try_write(record.bytes()))
+    {
+        ++written;
+    }
+    EXPECT_GT(written, 0);
+    EXPECT_EQ(ring.dropped(), 1u);
+    EXPECT_EQ(ring.drain([](auto) {}), static_cast<std::size_t>(written));
+    EXPECT_TRUE(ring.try_write(record.bytes()));
+}
+
+TEST(BinaryLog, ShortLivedLogsLeaveNoRingsBehind)
+{
+    uuids::binary_log lasting;
+    uuids::log_record record;
+    record.add(std::uint64_t{1});
+
+    // Each log's ring goes with the log; the thread's stale entries are pruned as it goes.
+    for (int i = 0; i < 1000; ++i)
+    {
+        uuids::binary_log brief(1024);
+        ASSERT_TRUE(brief.write(record));
+        ASSERT_TRUE(lasting.write(record));
+        EXPECT_EQ(brief.drain([](auto) {}), 1u);
+    }
+    EXPECT_EQ(lasting.drain([](auto) {}), 1000u);
+}
@@ -0,0 +1,221 @@
+#include <uuids/bulk.hpp>
+#include <uuids/uuidv7.hpp>
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+uuids::uuid make_v7(std::uint64_t unix_ms)
+{
+    uuids::detail::uuid_bytes bytes;
+    uuids::detail::v7_layout::encode(bytes, uuids::detail::v7_layout::tick(unix_ms));
+    return uuids::uuid(bytes);
+}
+
+uuids::uuid make_from_hex(std::string_view hex)
+{
+    std::array<std::uint8_t, 16> bytes{};
+    EXPECT_TRUE(uuids::detail::decode_hex(hex, bytes));
+    return uuids::uuid(bytes);
+}
+
+} // namespace
+
+TEST(Bulk, ExtractTimestampsAcrossVersions)
+{
+    // RFC 9562 appendix A test vectors, all 2022-02-22 19:22:22 UTC.
+    const auto v1 = make_from_hex("c232ab00941411ecb3c89f6bdeced846");
+    const auto v6 = make_from_hex("1ec9414c232a6b00b3c89f6bdeced846");
+    const auto v7 = make_from_hex("017f22e279b07cc398c4dc0c0c07398f");
+    const auto v4 = uuids::uuid_generator{}();
+
+    const std::vector<uuids::uuid> ids{v1, v6, v7, v4, v7};
+    std::vector<std::uint64_t> out(ids.size());
+    uuids::extract_timestamps(std::span<const uuids::uuid>(ids), out);
+
+    EXPECT_EQ(out[0], 1645557742000u);
+    EXPECT_EQ(out[1], 1645557742000u);
+    EXPECT_EQ(out[2], 1645557742000u);
+    EXPECT_EQ(out[3], 0u);
+    EXPECT_EQ(out[4], 1645557742000u);
+}
+
+TEST(Bulk, ExtractTimestampsVectorPathMatchesScalar)
+{
+    std::vector<uuids::uuid> ids;
+    for (std::uint64_t i = 0; i < 1003; ++i)
+    {
+        ids.push_back(i % 97 == 0 ? uuids::uuid_generator{}() : make_v7(1'700'000'000'000 + i));
+    }
+
+    std::vector<std::uint64_t> out(ids.size());
+    uuids::extract_timestamps(std::span<const uuids::uuid>(ids), out);
+
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+        ASSERT_EQ(out[i], uuids::detail::unix_ms_of(ids[i].bytes().data())) << i;
+    }
+}
+
+TEST(Bulk, FilterTimeRangeIsHalfOpenAndOrdered)
+{
+    std::vector<uuids::uuid> ids;
+    for (std::uint64_t i = 0; i < 1001; ++i)
+    {
+        ids.push_back(make_v7(1'000 + (i * 7919) % 1000));
+    }
+    ids[500] = make_from_hex("c232ab00941411ecb3c89f6bdeced846");
+
+    std::vector<std::size_t> out(ids.size());
+    const auto count =
+        uuids::filter_time_range(std::span<const uuids::uuid>(ids), 1'200, 1'300, out);
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+        const auto t = uuids::detail::unix_ms_of(ids[i].bytes().data());
+        if (t >= 1'200 && t < 1'300)
+        {
+            expected.push_back(i);
+        }
+    }
+
+    ASSERT_EQ(count, expected.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+}
+
+TEST(Bulk, FilterTimeRangeStopsWhenOutputIsFull)
+{
+    std::vector<uuids::uuid> ids(64, make_v7(5'000));
+    std::vector<std::size_t> out(10);
+
+    EXPECT_EQ(uuids::filter_time_range(std::span<const uuids::uuid>(ids), 0, 10'000, out), 10u);
+    EXPECT_EQ(out[9], 9u);
+}
+
+TEST(Bulk, ValidateManyMatchesScalarChecks)
+{
+    uuids::uuid_generator v4;
+    uuids::shared_uuid_v7_generator v7;
+    std::vector<uuids::uuid> ids;
+    for (std::size_t i = 0; i < 1003; ++i)
+    {
+        switch (i % 6)
+        {
+            case 0:
+                ids.push_back(v4());
+                break;
+            case 1:
+                ids.push_back(v7());
+                break;
+            case 2:
+                ids.push_back(uuids::uuid{});
+                break;
+            case 3:
+                ids.push_back(make_from_hex("ffffffffffffffffffffffffffffffff"));
+                break;
+            case 4:
+                // v4 with the Microsoft variant
+                ids.push_back(make_from_hex("c232ab00941441ecd3c89f6bdeced846"));
+                break;
+            default:
+                ids.push_back(make_from_hex("1ec9414c232a6b00b3c89f6bdeced846"));
+                break;
+        }
+    }
+
+    const std::uint16_t expected = uuids::version_bit(4) | uuids::version_bit(7);
+    std::vector<std::uint64_t> bitmap((ids.size() + 63) / 64, ~std::uint64_t{0});
+    const std::size_t valid = uuids::validate_many(std::span<const uuids::uuid>(ids), expected,
+                                                   bitmap);
+
+    std::size_t expected_valid = 0;
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+        const bool ok = i % 6 < 2;
+        expected_valid += ok ? 1 : 0;
+        EXPECT_EQ(((bitmap[i / 64] >> (i % 64)) & 1) != 0, ok) << i;
+    }
+    EXPECT_EQ(valid, expected_valid);
+    EXPECT_EQ(bitmap.back() >> (ids.size() % 64), 0u);
+
+    std::vector<std::uint64_t> all(bitmap.size());
+    EXPECT_EQ(uuids::validate_many(std::span<const uuids::uuid>(ids), uuids::rfc9562_versions, all),
+              expected_valid + ids.size() / 6);
+}
+
+TEST(Bulk, VersionHistogramCountsEveryNibble)
+{
+    std::vector<uuids::uuid> ids;
+    std::array<std::size_t, 16> expected{};
+    for (std::size_t i = 0; i < 20'000; ++i)
+    {
+        std::array<std::uint8_t, 16> bytes{};
+        const std::size_t version = (i * 7 + i / 3) % 16;
+        bytes[6] = static_cast<std::uint8_t>(version << 4 | (i & 0xF));
+        bytes[8] = static_cast<std::uint8_t>(i);
+        ids.emplace_back(bytes);
+        ++expected[version];
+    }
+    EXPECT_EQ(uuids::version_histogram(std::span<const uuids::uuid>(ids)), expected);
+
+    // Too short for the vector path.
+    const auto few = uuids::version_histogram(std::span<const uuids::uuid>(ids).first(31));
+    EXPECT_EQ(few[0], 3u);
+    EXPECT_EQ(few[15], 1u);
+}
+
+TEST(Bulk, HashManyMatchesScalarHash)
+{
+    uuids::basic_uuid_generator<std::mt19937_64> generator(9);
+    std::vector<uuids::uuid> ids(1003);
+    for (auto& id : ids)
+    {
+        id = generator();
+    }
+
+    std::vector<std::uint64_t> out(ids.size());
+    uuids::hash_many(std::span<const uuids::uuid>(ids), out);
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+        ASSERT_EQ(out[i], uuids::hash_value(ids[i]));
+        if constexpr (sizeof(std::size_t) == 8)
+        {
+            ASSERT_EQ(out[i], std::hash<uuids::uuid>{}(ids[i]));
+        }
+    }
+
+    const std::uint64_t seed = 0x0123456789ABCDEFULL;
+    uuids::hash_many(std::span<const uuids::uuid>(ids), out, seed);
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+        ASSERT_EQ(out[i], uuids::hash_value(ids[i], seed));
+    }
+    EXPECT_NE(uuids::hash_value(ids[0], seed), uuids::hash_value(ids[0]));
+}
+
+TEST(Bulk, FilterTimeRangeSkipsIdsWithoutTimestamps)
+{
+    uuids::basic_uuid_generator<std::mt19937_64> v4(3);
+    std::vector<uuids::uuid> ids;
+    for (std::size_t i = 0; i < 64; ++i)
+    {
+        // Every fourth slot is v7; the rest mix v4, nil and max through both code paths.
+        ids.push_back(i % 4 == 0 ? make_v7(5'000)
+                      : i % 4 == 1 ? v4()
+                      : i % 4 == 2 ? uuids::uuid()
+                                   : make_from_hex("ffffffffffffffffffffffffffffffff"));
+    }
+
+    std::vector<std::size_t> out(ids.size());
+    const auto count = uuids::filter_time_range(std::span<const uuids::uuid>(ids), 0, 10'000, out);
+    ASSERT_EQ(count, 16u);
+    for (std::size_t k = 0; k < count; ++k)
+    {
+        EXPECT_EQ(out[k], 4 * k);
+    }
+}
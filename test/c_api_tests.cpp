@@ -0,0 +1,78 @@
+#include <uuids/uuids.h>
+#include <uuids/uuidv4.hpp>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+
+TEST(CApi, GenerateFormatParseRoundTrip)
+{
+    EXPECT_EQ(uuids_abi_version(), UUIDS_ABI_VERSION);
+
+    constexpr std::size_t n = 1000;
+    std::vector<std::uint8_t> ids(16 * n);
+    uuids_generate_v4(ids.data(), n);
+
+    std::string text(UUIDS_TEXT_SIZE * n, '\0');
+    uuids_format_many(ids.data(), n, text.data());
+
+    std::vector<std::uint8_t> parsed(16 * n);
+    EXPECT_EQ(uuids_parse_many(text.data(), n, parsed.data()), n);
+    EXPECT_EQ(parsed, ids);
+
+    std::set<std::string> unique;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto id = uuids::uuid::parse(text.substr(UUIDS_TEXT_SIZE * i, UUIDS_TEXT_SIZE));
+        ASSERT_TRUE(id.has_value());
+        EXPECT_EQ(id->version(), 4);
+        unique.insert(id->str());
+    }
+    EXPECT_EQ(unique.size(), n);
+}
+
+TEST(CApi, ParseStopsAtFirstMalformedId)
+{
+    std::string text = "017f22e2-79b0-7cc3-98c4-dc0c0c07398f"
+                       "017f22e2-79b0-7cc3-98c4-dc0c0c07398g"
+                       "017f22e2-79b0-7cc3-98c4-dc0c0c07398f";
+    std::array<std::uint8_t, 48> out{};
+    EXPECT_EQ(uuids_parse_many(text.data(), 3, out.data()), 1u);
+    EXPECT_EQ(out[0], 0x01);
+}
+
+TEST(CApi, V7IsStrictlyIncreasing)
+{
+    constexpr std::size_t n = 1000;
+    std::vector<std::uint8_t> ids(16 * n);
+    uuids_generate_v7(ids.data(), n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        EXPECT_EQ(ids[16 * i + 6] >> 4, 7);
+        if (i > 0)
+        {
+            EXPECT_LT(std::memcmp(&ids[16 * (i - 1)], &ids[16 * i], 16), 0);
+        }
+    }
+}
+
+TEST(CApi, HashMatchesStdHash)
+{
+    uuids_generator* generator = uuids_generator_new();
+    ASSERT_NE(generator, nullptr);
+
+    std::array<std::uint8_t, 16 * 8> ids;
+    uuids_generator_v4(generator, ids.data(), 8);
+    uuids_generator_free(generator);
+
+    std::array<std::uint64_t, 8> hashes;
+    uuids_hash_many(ids.data(), 8, hashes.data());
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        const uuids::uuid id(std::span<const std::uint8_t, 16>(ids.data() + 16 * i, 16));
+        EXPECT_EQ(hashes[i], std::hash<uuids::uuid>{}(id));
+    }
+}
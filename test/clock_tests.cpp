@@ -0,0 +1,117 @@
+#include <uuids/clock.hpp>
+#include <uuids/uuidv7.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+
+struct manual_clock
+{
+    static inline std::uint64_t now_ms = 1'700'000'000'000;
+
+    static std::uint64_t unix_ms() noexcept { return now_ms; }
+};
+
+template <typename Clock>
+void expect_close_to_system()
+{
+    const auto reference = uuids::system_clock_source::unix_ms();
+    const auto value = Clock::unix_ms();
+    const auto distance = value > reference ? value - reference : reference - value;
+    // Loose enough for a loaded CI machine; a miscalibrated clock is off by far more.
+    EXPECT_LE(distance, 200u);
+}
+
+} // namespace
+
+static_assert(uuids::ClockSource<uuids::system_clock_source>);
+static_assert(uuids::ClockSource<uuids::coarse_clock_source>);
+static_assert(uuids::ClockSource<uuids::tsc_clock_source>);
+static_assert(uuids::ClockSource<uuids::cached_clock_source>);
+
+TEST(ClockSource, AllSourcesTrackWallTime)
+{
+    expect_close_to_system<uuids::coarse_clock_source>();
+    expect_close_to_system<uuids::tsc_clock_source>();
+    expect_close_to_system<uuids::cached_clock_source>();
+}
+
+TEST(ClockSource, CachedClockAdvances)
+{
+    const auto start = uuids::cached_clock_source::unix_ms();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_GT(uuids::cached_clock_source::unix_ms(), start);
+}
+
+TEST(ClockSource, TscClockIsMonotonicAcrossReads)
+{
+    auto previous = uuids::tsc_clock_source::unix_ms();
+    for (int i = 0; i < 100000; ++i)
+    {
+        const auto next = uuids::tsc_clock_source::unix_ms();
+        ASSERT_GE(next + 1, previous);
+        previous = next;
+    }
+}
+
+TEST(ClockSource, TscClockIsMonotonicAcrossResyncs)
+{
+    const auto until = std::chrono::steady_clock::now() +
+                       std::chrono::nanoseconds(uuids::detail::tsc_calibration::resync_period_ns) +
+                       std::chrono::milliseconds(200);
+    auto previous = uuids::detail::tsc_calibration::instance().unix_ns();
+    while (std::chrono::steady_clock::now() < until)
+    {
+        const auto next = uuids::detail::tsc_calibration::instance().unix_ns();
+        ASSERT_GE(next, previous);
+        previous = next;
+    }
+}
+
+TEST(ClockSource, CachedClockTicksInForkedChild)
+{
+    static_cast<void>(uuids::cached_clock_source::unix_ms());
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        const auto start = uuids::cached_clock_source::unix_ms();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ::_exit(uuids::cached_clock_source::unix_ms() > start ? 0 : 1);
+    }
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+TEST(ClockSource, GeneratorSurvivesClockStepBack)
+{
+    uuids::basic_shared_uuid_v7_generator<std::mt19937_64, manual_clock> gen;
+
+    std::vector<uuids::uuid> ids;
+    ids.push_back(gen());
+    manual_clock::now_ms -= 60'000;
+    ids.push_back(gen());
+    manual_clock::now_ms += 120'000;
+    ids.push_back(gen());
+
+    EXPECT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+    EXPECT_EQ(std::adjacent_find(ids.begin(), ids.end()), ids.end());
+}
+
+TEST(ClockSource, FastClocksDriveGenerators)
+{
+    uuids::basic_shared_uuid_v7_generator<std::mt19937_64, uuids::tsc_clock_source> tsc_gen;
+    uuids::basic_shared_uuid_v7_generator<std::mt19937_64, uuids::cached_clock_source> cached_gen;
+
+    EXPECT_EQ(tsc_gen().version(), 7);
+    EXPECT_EQ(cached_gen().version(), 7);
+}
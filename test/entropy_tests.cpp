@@ -0,0 +1,139 @@
+#include <uuids/entropy.hpp>
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+TEST(EntropyPool, SeedsAreDistinctAcrossRefillsAndThreads)
+{
+    std::mutex mutex;
+    std::set<uuids::seed256> seeds;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                std::vector<uuids::seed256> local;
+                for (int i = 0; i < 1000; ++i)
+                {
+                    local.push_back(uuids::fresh_seed());
+                }
+                std::lock_guard lock(mutex);
+                seeds.insert(local.begin(), local.end());
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(seeds.size(), 4000u);
+}
+
+TEST(EntropyPool, ChildAfterForkGetsDifferentSeeds)
+{
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    static_cast<void>(uuids::fresh_seed());
+
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        const auto seed = uuids::fresh_seed();
+        const bool written = ::write(fds[1], &seed, sizeof(seed)) == sizeof(seed);
+        ::_exit(written ? 0 : 1);
+    }
+
+    const auto parent_seed = uuids::fresh_seed();
+    uuids::seed256 child_seed{};
+    ASSERT_EQ(::read(fds[0], &child_seed, sizeof(child_seed)),
+              static_cast<ssize_t>(sizeof(child_seed)));
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    ::close(fds[0]);
+    ::close(fds[1]);
+    EXPECT_NE(parent_seed, child_seed);
+}
+
+TEST(EntropyPoolDeathTest, AbortsWhenTheKernelHasNoEntropy)
+{
+    EXPECT_DEATH(
+        {
+            uuids::detail::os_entropy_source = [](std::span<std::byte>) noexcept
+            { return false; };
+            // The first seeds come from the fill made at start-up; the refill after them fails.
+            for (std::size_t i = 0; i <= uuids::detail::entropy_pool::seeds_per_fill; ++i)
+            {
+                static_cast<void>(uuids::fresh_seed());
+            }
+        },
+        "");
+}
+
+TEST(SeededEngine, FullStateExpansionIsDeterministic)
+{
+    const uuids::seed256 seed{1, 2, 3, 4};
+    auto a = uuids::seeded_engine<std::mt19937_64>(seed);
+    auto b = uuids::seeded_engine<std::mt19937_64>(seed);
+    EXPECT_EQ(a(), b());
+
+    // Engines seeded from seeds that differ in any word produce different streams.
+    auto c = uuids::seeded_engine<std::mt19937_64>(uuids::seed256{1, 2, 3, 5});
+    EXPECT_NE(a(), c());
+
+    auto fresh1 = uuids::seeded_engine<std::mt19937_64>();
+    auto fresh2 = uuids::seeded_engine<std::mt19937_64>();
+    EXPECT_NE(fresh1(), fresh2());
+}
+
+TEST(OsEntropyEngine, WipesConsumedWords)
+{
+    uuids::os_entropy_engine engine;
+    std::set<std::uint64_t> values;
+    for (int i = 0; i < 1000; ++i)
+    {
+        values.insert(engine());
+    }
+    EXPECT_EQ(values.size(), 1000u);
+
+    const auto& buffer = uuids::detail::local_os_entropy();
+    ASSERT_GT(buffer.position(), 0u);
+    for (std::size_t i = 0; i < buffer.position(); ++i)
+    {
+        EXPECT_EQ(buffer.data()[i], 0u);
+    }
+}
+
+TEST(OsEntropyEngine, ChildAfterForkDiscardsBufferedWords)
+{
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    uuids::os_entropy_engine engine;
+    static_cast<void>(engine());
+
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        const std::uint64_t word = engine();
+        const bool written = ::write(fds[1], &word, sizeof(word)) == sizeof(word);
+        ::_exit(written ? 0 : 1);
+    }
+
+    const std::uint64_t parent_word = engine();
+    std::uint64_t child_word = 0;
+    ASSERT_EQ(::read(fds[0], &child_word, sizeof(child_word)),
+              static_cast<ssize_t>(sizeof(child_word)));
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    ::close(fds[0]);
+    ::close(fds[1]);
+    EXPECT_NE(parent_word, child_word);
+}
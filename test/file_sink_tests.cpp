@@ -0,0 +1,194 @@
+#include <uuids/file_sink.hpp>
+#include <uuids/uuidv4.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+std::string temp_path(const char* tag)
+{
+    return "/tmp/uuids-" + std::string(tag) + "-" + std::to_string(::getpid()) + ".out";
+}
+
+std::vector<uuids::uuid> make_ids(std::size_t n)
+{
+    uuids::uuid_generator gen;
+    std::vector<uuids::uuid> ids(n);
+    for (auto& id : ids)
+    {
+        id = gen();
+    }
+    return ids;
+}
+
+std::string read_file(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+std::string binary_of(const std::vector<uuids::uuid>& ids)
+{
+    std::string bytes;
+    for (const auto& id : ids)
+    {
+        bytes.append(reinterpret_cast<const char*>(id.bytes().data()), uuids::uuid::size());
+    }
+    return bytes;
+}
+
+std::string text_of(const std::vector<uuids::uuid>& ids)
+{
+    std::string text;
+    for (const auto& id : ids)
+    {
+        text += id.str() + '\n';
+    }
+    return text;
+}
+
+} // namespace
+
+TEST(FileSink, BinaryAndTextThroughBothWriters)
+{
+    const auto ids = make_ids(5000);
+    for (const bool io_uring : {true, false})
+    {
+        const auto path = temp_path(io_uring ? "uring" : "thread");
+        uuids::file_sink_options options;
+        options.buffer_size = 4096;
+        options.buffer_count = 2;
+        options.io_uring = io_uring;
+        {
+            uuids::uuid_file_sink sink(path, options);
+            if (!io_uring)
+            {
+                EXPECT_FALSE(sink.uses_io_uring());
+            }
+            sink.write(ids);
+            sink.write_text(ids);
+            sink.close();
+            EXPECT_EQ(sink.bytes_submitted(), ids.size() * (16 + 37));
+        }
+        EXPECT_EQ(read_file(path), binary_of(ids) + text_of(ids));
+        std::remove(path.c_str());
+    }
+}
+
+TEST(FileSink, ZeroCopyBuffers)
+{
+    const auto path = temp_path("zerocopy");
+    {
+        uuids::uuid_file_sink sink(path, uuids::file_sink_options{8192, 3, false, true});
+        for (int round = 0; round < 10; ++round)
+        {
+            const auto space = sink.buffer();
+            ASSERT_EQ(space.size(), sink.buffer_size());
+            std::fill(space.begin(), space.end(), static_cast<std::byte>('a' + round));
+            sink.commit(space.size());
+        }
+    }
+
+    const std::string data = read_file(path);
+    ASSERT_EQ(data.size(), 10u * 8192);
+    for (int round = 0; round < 10; ++round)
+    {
+        EXPECT_EQ(data[static_cast<std::size_t>(round) * 8192 + 100], 'a' + round);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(FileSink, PipeKeepsOrder)
+{
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    std::string received;
+    std::thread reader(
+        [&]()
+        {
+            char chunk[4096];
+            ssize_t n = 0;
+            while ((n = ::read(fds[0], chunk, sizeof(chunk))) > 0)
+            {
+                received.append(chunk, static_cast<std::size_t>(n));
+            }
+        });
+
+    const auto ids = make_ids(3000);
+    {
+        uuids::uuid_file_sink sink(fds[1], uuids::file_sink_options{4096, 4, false, true});
+        EXPECT_FALSE(sink.uses_io_uring());
+        sink.write_text(ids);
+    }
+    ::close(fds[1]);
+    reader.join();
+    ::close(fds[0]);
+    EXPECT_EQ(received, text_of(ids));
+}
+
+TEST(FileSink, DirectWritesUnalignedTail)
+{
+#if defined(O_DIRECT)
+    const auto path = temp_path("direct");
+    const auto ids = make_ids(1001);
+    try
+    {
+        uuids::uuid_file_sink sink(path, uuids::file_sink_options{4096, 2, true, true});
+        sink.write(ids);
+        sink.flush();
+        sink.write(ids);
+    }
+    catch (const std::system_error& error)
+    {
+        std::remove(path.c_str());
+        GTEST_SKIP() << "O_DIRECT unsupported here: " << error.what();
+    }
+    EXPECT_EQ(read_file(path), binary_of(ids) + binary_of(ids));
+    std::remove(path.c_str());
+#else
+    GTEST_SKIP() << "no O_DIRECT";
+#endif
+}
+
+TEST(FileSink, WriteErrorsKeepBuffersAndCloseTheFile)
+{
+    const auto ids = make_ids(1000);
+    for (const bool io_uring : {true, false})
+    {
+        // The sink's descriptor takes the lowest free number, which this probe finds.
+        const int probe = ::open("/dev/null", O_RDONLY);
+        ASSERT_GE(probe, 0);
+        ::close(probe);
+
+        uuids::file_sink_options options;
+        options.buffer_size = 4096;
+        options.buffer_count = 2;
+        options.io_uring = io_uring;
+        uuids::uuid_file_sink sink("/dev/full", options);
+
+        // Every failed write returns its buffer; otherwise the third attempt would wait forever
+        // for a buffer that is never coming back.
+        for (int attempt = 0; attempt < 5; ++attempt)
+        {
+            EXPECT_THROW(
+                {
+                    sink.write(ids);
+                    sink.flush();
+                },
+                std::system_error);
+        }
+
+        sink.write(std::span(ids).first(1));
+        EXPECT_THROW(sink.close(), std::system_error);
+        EXPECT_EQ(::fcntl(probe, F_GETFD), -1);
+    }
+}
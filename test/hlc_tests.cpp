@@ -0,0 +1,62 @@
+#include <uuids/hlc.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+std::uint64_t tick_of(const uuids::uuid& id)
+{
+    return uuids::detail::v7_layout::decode_tick(uuids::detail::uuid_bytes{id.bytes()});
+}
+
+} // namespace
+
+TEST(HLC, LocalEventsAreIncreasing)
+{
+    uuids::hlc_uuid_generator node;
+
+    std::vector<uuids::uuid> ids(5000);
+    node.generate(ids);
+    ids.push_back(node());
+
+    EXPECT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+    EXPECT_EQ(std::adjacent_find(ids.begin(), ids.end()), ids.end());
+    EXPECT_EQ(ids.back().version(), 7);
+}
+
+TEST(HLC, ReceiveOrdersAfterRemoteClockAhead)
+{
+    uuids::hlc_uuid_generator local;
+    uuids::hlc_uuid_generator remote;
+
+    const auto ahead_ms = uuids::detail::system_unix_ms() + 5000;
+    ASSERT_TRUE(remote.receive_tick(uuids::detail::v7_layout::tick(ahead_ms, 7)));
+    const auto message = remote();
+
+    EXPECT_TRUE(local.receive(message));
+    const auto reply = local();
+
+    EXPECT_LT(message, reply);
+    EXPECT_EQ(tick_of(reply), tick_of(message) + 1);
+}
+
+TEST(HLC, ReceiveOfOlderClockKeepsLocalOrder)
+{
+    uuids::hlc_uuid_generator node;
+    const auto before = node();
+
+    EXPECT_TRUE(node.receive_tick(uuids::detail::v7_layout::tick(1)));
+    EXPECT_LT(before, node());
+}
+
+TEST(HLC, ReceiveRejectsExcessiveDrift)
+{
+    uuids::hlc_uuid_generator node(std::chrono::milliseconds(100));
+    const auto far_ms = uuids::detail::system_unix_ms() + 3'600'000;
+
+    EXPECT_FALSE(node.receive_tick(uuids::detail::v7_layout::tick(far_ms)));
+    EXPECT_LT(tick_of(node()) >> uuids::detail::v7_layout::counter_bits, far_ms);
+}
@@ -0,0 +1,139 @@
+#include <uuids/quality.hpp>
+#include <uuids/uuidv4.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+template <typename Generator>
+std::vector<uuids::uuid> generate(Generator& generator, std::size_t n)
+{
+    std::vector<uuids::uuid> ids(n);
+    for (auto& id : ids)
+    {
+        id = generator();
+    }
+    return ids;
+}
+
+uuids::randomness_report test(const std::vector<uuids::uuid>& ids)
+{
+    uuids::randomness_tester tester;
+    tester.add(ids);
+    return tester.report();
+}
+
+// Rewrites the four 32-bit words of every ID and restores the version and variant bits.
+template <typename F>
+void rewrite_words(std::vector<uuids::uuid>& ids, F&& word)
+{
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+        std::array<std::uint8_t, 16> bytes = ids[i].bytes();
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            const std::uint32_t value = word(i, k);
+            std::memcpy(bytes.data() + 4 * k, &value, 4);
+        }
+        bytes[6] = static_cast<std::uint8_t>((bytes[6] & 0x0F) | 0x40);
+        bytes[8] = static_cast<std::uint8_t>((bytes[8] & 0x3F) | 0x80);
+        ids[i] = uuids::uuid(bytes);
+    }
+}
+
+} // namespace
+
+TEST(Quality, SoundEnginesPass)
+{
+    uuids::uuid_generator hardware;
+    const auto report = test(generate(hardware, 1 << 20));
+    EXPECT_EQ(report.ids, 1u << 20);
+    EXPECT_TRUE(report.passed()) << report.bit_z << ' ' << report.byte_z << ' ' << report.serial_z
+                                 << ' ' << report.birthday_z;
+
+    uuids::basic_uuid_generator<std::mt19937_64> software(42);
+    const auto software_report = test(generate(software, 1 << 20));
+    EXPECT_TRUE(software_report.passed());
+    EXPECT_LT(std::abs(software_report.serial_correlation), 0.01);
+}
+
+TEST(Quality, BatchingDoesNotChangeTheReport)
+{
+    uuids::basic_uuid_generator<std::mt19937_64> generator(7);
+    const auto ids = generate(generator, 10000);
+
+    uuids::randomness_tester batched;
+    for (std::size_t first = 0; first < ids.size(); first += 999)
+    {
+        batched.add(std::span(ids).subspan(first, std::min<std::size_t>(999, ids.size() - first)));
+    }
+    const auto whole = test(ids);
+    const auto parts = batched.report();
+    EXPECT_EQ(parts.bit_z, whole.bit_z);
+    EXPECT_EQ(parts.byte_z, whole.byte_z);
+    EXPECT_NEAR(parts.serial_correlation, whole.serial_correlation, 1e-12);
+    EXPECT_EQ(parts.birthday_z, whole.birthday_z);
+}
+
+TEST(Quality, DetectsBiasedBits)
+{
+    uuids::basic_uuid_generator<std::mt19937_64> generator(1);
+    auto ids = generate(generator, 1 << 16);
+    std::mt19937 rng(2);
+    rewrite_words(ids,
+                  [&](std::size_t, std::size_t k)
+                  {
+                      const auto value = static_cast<std::uint32_t>(rng());
+                      // Bit 0 of byte 0 is set three times out of four.
+                      return k == 0 && (value >> 30) != 0 ? value | 0x80 : value;
+                  });
+
+    const auto report = test(ids);
+    EXPECT_FALSE(report.passed());
+    EXPECT_EQ(report.bit, 0u);
+    EXPECT_GT(report.bit_z, 50);
+    EXPECT_EQ(report.byte, 0u);
+}
+
+TEST(Quality, DetectsSerialCorrelation)
+{
+    uuids::basic_uuid_generator<std::mt19937_64> generator(3);
+    auto ids = generate(generator, 1 << 16);
+    std::mt19937 rng(4);
+    std::uint32_t previous = 0;
+    // Half of the words keep the top byte of the word before them.
+    rewrite_words(ids,
+                  [&](std::size_t, std::size_t)
+                  {
+                      const auto value = static_cast<std::uint32_t>(rng());
+                      previous = (rng() & 1) != 0 ? (previous & 0xFF000000) | (value >> 8) : value;
+                      return previous;
+                  });
+
+    const auto report = test(ids);
+    EXPECT_GT(report.serial_z, 50);
+    EXPECT_FALSE(report.passed());
+}
+
+TEST(Quality, DetectsCoarseBirthdays)
+{
+    uuids::basic_uuid_generator<std::mt19937_64> generator(5);
+    auto ids = generate(generator, 1 << 16);
+    std::mt19937 rng(6);
+    // Bytes 12..15 only take 2^24 distinct values, so equal spacings become far more common.
+    rewrite_words(ids,
+                  [&](std::size_t, std::size_t k)
+                  {
+                      const auto value = static_cast<std::uint32_t>(rng());
+                      return k == 3 ? value & 0xFFFFFF00 : value;
+                  });
+
+    const auto report = test(ids);
+    EXPECT_GT(report.birthday_z, 10);
+    EXPECT_FALSE(report.passed());
+}
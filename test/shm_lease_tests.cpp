@@ -0,0 +1,119 @@
+#include <uuids/shm_lease.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+TEST(ShmLease, GeneratorsOnOneSegmentNeverOverlap)
+{
+    auto coordinator = uuids::shm_lease_coordinator::anonymous();
+    uuids::leased_uuid_v7_generator a(coordinator, 16);
+    uuids::leased_uuid_v7_generator b(coordinator, 16);
+
+    std::vector<uuids::uuid> from_a(500);
+    std::vector<uuids::uuid> from_b(500);
+    for (std::size_t i = 0; i < from_a.size(); ++i)
+    {
+        from_a[i] = a();
+        from_b[i] = b();
+    }
+
+    EXPECT_TRUE(std::is_sorted(from_a.begin(), from_a.end()));
+    EXPECT_TRUE(std::is_sorted(from_b.begin(), from_b.end()));
+
+    std::set<uuids::uuid> all(from_a.begin(), from_a.end());
+    all.insert(from_b.begin(), from_b.end());
+    EXPECT_EQ(all.size(), from_a.size() + from_b.size());
+    EXPECT_EQ(from_a.front().version(), 7);
+}
+
+TEST(ShmLease, NamedSegmentIsSharedBetweenMappings)
+{
+    const std::string name = "/uuids-lease-test-" + std::to_string(::getpid());
+    uuids::shm_lease_coordinator::unlink(name);
+
+    auto first = uuids::shm_lease_coordinator::open(name);
+    auto second = uuids::shm_lease_coordinator::open(name);
+
+    const auto owner = first.attach();
+    const auto lease_a = first.lease(owner, 100);
+    const auto lease_b = second.lease(owner, 100);
+    EXPECT_GE(lease_b.first, lease_a.end);
+
+    first.detach(owner);
+    uuids::shm_lease_coordinator::unlink(name);
+}
+
+TEST(ShmLease, CrashedWorkerSlotIsReclaimed)
+{
+    auto coordinator = uuids::shm_lease_coordinator::anonymous();
+
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        [[maybe_unused]] const auto registration = coordinator.attach();
+        ::_exit(0);
+    }
+
+    int status = 0;
+    ::waitpid(child, &status, 0);
+
+    const auto epoch = coordinator.epoch();
+    EXPECT_EQ(coordinator.reclaim_dead(), 1u);
+    EXPECT_EQ(coordinator.epoch(), epoch + 1);
+
+    const auto mine = coordinator.attach();
+    EXPECT_EQ(mine.slot, 0u);
+    EXPECT_TRUE(coordinator.owns(mine));
+    coordinator.detach(mine);
+    EXPECT_FALSE(coordinator.owns(mine));
+}
+
+TEST(ShmLease, ForkedChildTakesItsOwnRange)
+{
+    auto coordinator = uuids::shm_lease_coordinator::anonymous();
+    uuids::leased_uuid_v7_generator generator(coordinator, 64);
+    static_cast<void>(generator());
+    const auto parent_registration = generator.registration();
+
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        ::close(fds[0]);
+        uuids::uuid ids[32];
+        for (auto& id : ids)
+        {
+            id = generator();
+        }
+        const bool own_slot = generator.registration().slot != parent_registration.slot;
+        const bool written = ::write(fds[1], ids, sizeof(ids)) == static_cast<ssize_t>(sizeof(ids));
+        ::_exit(own_slot && written ? 0 : 1);
+    }
+    ::close(fds[1]);
+
+    std::vector<uuids::uuid> from_parent(32);
+    for (auto& id : from_parent)
+    {
+        id = generator();
+    }
+    uuids::uuid from_child[32];
+    ASSERT_EQ(::read(fds[0], from_child, sizeof(from_child)),
+              static_cast<ssize_t>(sizeof(from_child)));
+    ::close(fds[0]);
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    std::set<uuids::uuid> all(from_parent.begin(), from_parent.end());
+    all.insert(std::begin(from_child), std::end(from_child));
+    EXPECT_EQ(all.size(), 64u);
+    EXPECT_TRUE(coordinator.owns(parent_registration));
+}
@@ -0,0 +1,50 @@
+#include <uuids/snowflake.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+struct small_layout
+{
+    static constexpr unsigned timestamp_bits = 40;
+    static constexpr unsigned worker_bits = 4;
+    static constexpr unsigned sequence_bits = 2;
+    static constexpr std::uint64_t epoch_ms = 1577836800000;
+};
+
+TEST(Snowflake, ComposeAndDecompose)
+{
+    const auto id = uuids::snowflake::compose(123456789, 513, 4095);
+    EXPECT_EQ(id.timestamp(), 123456789u);
+    EXPECT_EQ(id.worker(), 513u);
+    EXPECT_EQ(id.sequence(), 4095u);
+    EXPECT_EQ(id.unix_ms(), 123456789u + uuids::twitter_snowflake_layout::epoch_ms);
+}
+
+TEST(Snowflake, TextRoundTrip)
+{
+    const uuids::snowflake id(0x0123456789abcdefULL);
+    EXPECT_EQ(id.str(), "0123456789abcdef");
+    EXPECT_EQ(uuids::snowflake::parse("0123456789ABCDEF"), id);
+    EXPECT_FALSE(uuids::snowflake::parse("0123456789abcdeg").has_value());
+    EXPECT_FALSE(uuids::snowflake::parse("0123").has_value());
+}
+
+TEST(Snowflake, GeneratorCarriesSequenceOverflowIntoTimestamp)
+{
+    uuids::snowflake_generator<small_layout> gen(9);
+
+    std::vector<uuids::basic_snowflake<small_layout>> ids(64);
+    gen.generate(ids);
+
+    EXPECT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+    EXPECT_EQ(std::adjacent_find(ids.begin(), ids.end()), ids.end());
+    EXPECT_TRUE(
+        std::all_of(ids.begin(), ids.end(), [](const auto& id) { return id.worker() == 9; }));
+    EXPECT_GE(ids.back().timestamp() - ids.front().timestamp(), 15u);
+}
+
+TEST(Snowflake, GeneratorRejectsOversizedWorker)
+{
+    EXPECT_THROW(uuids::snowflake_generator<small_layout>(16), std::out_of_range);
+}
@@ -0,0 +1,112 @@
+#include <uuids/trace.hpp>
+#include <gtest/gtest.h>
+
+#include <set>
+#include <type_traits>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+TEST(TraceContext, ParsesAndFormatsSpecExample)
+{
+    constexpr std::string_view header = "00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01";
+    const auto context = uuids::parse_traceparent(header);
+    ASSERT_TRUE(context.has_value());
+    EXPECT_TRUE(context->sampled());
+    EXPECT_EQ(context->trace.bytes[0], 0x4B);
+    EXPECT_EQ(context->trace.bytes[15], 0x36);
+    EXPECT_EQ(context->span.bytes[0], 0x00);
+    EXPECT_EQ(context->span.bytes[7], 0xB7);
+    EXPECT_EQ(uuids::to_traceparent(*context), header);
+}
+
+TEST(TraceContext, RejectsInvalidHeaders)
+{
+    using uuids::parse_traceparent;
+    EXPECT_FALSE(parse_traceparent(""));
+    EXPECT_FALSE(parse_traceparent("00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7"));
+    EXPECT_FALSE(parse_traceparent("ff-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01"));
+    EXPECT_FALSE(parse_traceparent("00-00000000000000000000000000000000-00f067aa0ba902b7-01"));
+    EXPECT_FALSE(parse_traceparent("00-4bf92f3577b34da6a3ce929d0e0e4736-0000000000000000-01"));
+    EXPECT_FALSE(parse_traceparent("00-4bf92f3577b34da6a3ce929d0e0e4736_00f067aa0ba902b7-01"));
+    EXPECT_FALSE(parse_traceparent("00-4bf92f3577b34da6a3ce929d0e0e473g-00f067aa0ba902b7-01"));
+    EXPECT_FALSE(parse_traceparent("00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01-x"));
+    EXPECT_FALSE(parse_traceparent("00-4BF92F3577B34DA6A3CE929D0E0E4736-00f067aa0ba902b7-01"));
+    EXPECT_FALSE(parse_traceparent("00-4bf92f3577b34da6a3ce929d0e0e4736-00F067AA0BA902B7-01"));
+    EXPECT_FALSE(parse_traceparent("00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-0A"));
+
+    EXPECT_TRUE(parse_traceparent("01-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01-x"));
+}
+
+TEST(TraceIdGenerator, ChildKeepsTraceAndFlags)
+{
+    uuids::trace_id_generator gen;
+    const auto root = gen.new_trace();
+    EXPECT_TRUE(root.sampled());
+    EXPECT_TRUE(root.trace.valid());
+
+    const auto child = gen.child_of(root);
+    EXPECT_EQ(child.trace, root.trace);
+    EXPECT_EQ(child.flags, root.flags);
+    EXPECT_NE(child.span, root.span);
+
+    std::set<uuids::trace_id> traces;
+    for (int i = 0; i < 1000; ++i)
+    {
+        traces.insert(gen.next_trace_id());
+    }
+    EXPECT_EQ(traces.size(), 1000u);
+}
+
+TEST(TraceIdGenerator, IsNotCopyable)
+{
+    static_assert(!std::is_copy_constructible_v<uuids::trace_id_generator>);
+    static_assert(!std::is_copy_assignable_v<uuids::trace_id_generator>);
+}
+
+TEST(TraceIdGenerator, ForkedChildDrawsFreshIds)
+{
+    uuids::trace_id_generator gen;
+    static_cast<void>(gen.next_trace_id());
+
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        ::close(fds[0]);
+        const uuids::trace_id id = gen.next_trace_id();
+        const bool written = ::write(fds[1], &id, sizeof(id)) == static_cast<ssize_t>(sizeof(id));
+        ::_exit(written ? 0 : 1);
+    }
+    ::close(fds[1]);
+
+    const uuids::trace_id from_parent = gen.next_trace_id();
+    uuids::trace_id from_child;
+    ASSERT_EQ(::read(fds[0], &from_child, sizeof(from_child)),
+              static_cast<ssize_t>(sizeof(from_child)));
+    ::close(fds[0]);
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    EXPECT_NE(from_child, from_parent);
+}
+
+TEST(TraceSampler, DecisionFollowsProbability)
+{
+    uuids::trace_id_generator gen(7);
+    const uuids::trace_sampler never(0.0);
+    const uuids::trace_sampler half(0.5);
+
+    int sampled = 0;
+    for (int i = 0; i < 10000; ++i)
+    {
+        const auto context = gen.new_trace(half);
+        EXPECT_EQ(context.sampled(), half(context.trace));
+        EXPECT_FALSE(never(context.trace));
+        sampled += context.sampled() ? 1 : 0;
+    }
+    EXPECT_GT(sampled, 4500);
+    EXPECT_LT(sampled, 5500);
+}
@@ -0,0 +1,204 @@
+#include <uuids/uuid_map.hpp>
+#include <uuids/uuidv4.hpp>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+TEST(UuidMap, InsertFindErase)
+{
+    uuids::uuid_generator gen;
+    uuids::uuid_map<int> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(gen()));
+
+    std::vector<uuids::uuid> keys(1000);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        keys[i] = gen();
+        EXPECT_TRUE(map.try_emplace(keys[i], static_cast<int>(i)).second);
+    }
+    EXPECT_EQ(map.size(), keys.size());
+    EXPECT_FALSE(map.try_emplace(keys[0], -1).second);
+
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        ASSERT_NE(map.find(keys[i]), map.end());
+        EXPECT_EQ(map.at(keys[i]), static_cast<int>(i));
+    }
+
+    for (std::size_t i = 0; i < keys.size(); i += 2)
+    {
+        EXPECT_EQ(map.erase(keys[i]), 1u);
+    }
+    EXPECT_EQ(map.size(), keys.size() / 2);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        EXPECT_EQ(map.contains(keys[i]), i % 2 == 1);
+    }
+    EXPECT_THROW(static_cast<void>(map.at(keys[0])), std::out_of_range);
+}
+
+TEST(UuidMap, ChurnReusesTombstones)
+{
+    uuids::uuid_generator gen;
+    uuids::uuid_map<std::string> map;
+    map.reserve(64);
+    const std::size_t capacity = map.capacity();
+
+    for (int round = 0; round < 1000; ++round)
+    {
+        const auto key = gen();
+        map[key] = "value";
+        EXPECT_EQ(map.erase(key), 1u);
+    }
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.capacity(), capacity);
+}
+
+TEST(UuidMap, IterationAndCopy)
+{
+    uuids::uuid_generator gen;
+    uuids::uuid_map<int> map;
+    for (int i = 0; i < 100; ++i)
+    {
+        map.insert_or_assign(gen(), i);
+    }
+
+    int sum = 0;
+    for (const auto& [key, value] : map)
+    {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 4950);
+
+    const uuids::uuid_map<int> copy = map;
+    EXPECT_EQ(copy.size(), map.size());
+    for (const auto& [key, value] : map)
+    {
+        EXPECT_EQ(copy.at(key), value);
+    }
+}
+
+TEST(UuidMap, AllocatesFromItsMemoryResource)
+{
+    std::vector<std::byte> arena_buffer(1 << 18);
+    std::pmr::monotonic_buffer_resource arena(arena_buffer.data(), arena_buffer.size(),
+                                              std::pmr::null_memory_resource());
+
+    static_assert(std::is_constructible_v<uuids::uuid_map<int>, int>);
+    static_assert(std::is_constructible_v<uuids::uuid_set<>, int>);
+
+    uuids::uuid_generator gen;
+    uuids::uuid_map<int> map(0, &arena);
+    for (int i = 0; i < 1000; ++i)
+    {
+        map.try_emplace(gen(), i);
+    }
+    EXPECT_EQ(map.resource(), &arena);
+
+    const uuids::uuid_map<int> copy = map;
+    EXPECT_EQ(copy.resource(), std::pmr::get_default_resource());
+
+    uuids::uuid_map<int> moved = std::move(map);
+    EXPECT_EQ(moved.resource(), &arena);
+
+    // Assignment keeps each table's own resource, so nothing outlives the arena.
+    uuids::uuid_map<int> heap;
+    heap = std::move(moved);
+    EXPECT_EQ(heap.resource(), std::pmr::get_default_resource());
+    ASSERT_EQ(heap.size(), 1000u);
+    for (const auto& [key, value] : copy)
+    {
+        EXPECT_EQ(heap.at(key), value);
+    }
+
+    uuids::uuid_map<int> scratch(0, &arena);
+    scratch = heap;
+    EXPECT_EQ(scratch.resource(), &arena);
+    EXPECT_EQ(scratch.size(), 1000u);
+}
+
+TEST(UuidMap, LookupManyMatchesFind)
+{
+    uuids::uuid_generator gen;
+    uuids::uuid_map<std::size_t> map;
+    std::vector<uuids::uuid> keys;
+    for (std::size_t i = 0; i < 5000; ++i)
+    {
+        keys.push_back(gen());
+        if (i % 3 != 0)
+        {
+            map.try_emplace(keys.back(), i);
+        }
+    }
+
+    std::vector<bool> seen(keys.size(), false);
+    map.lookup_many(std::span<const uuids::uuid>(keys),
+                    [&](std::size_t index, std::pair<const uuids::uuid, std::size_t>* entry)
+                    {
+                        seen[index] = true;
+                        if (index % 3 == 0)
+                        {
+                            EXPECT_EQ(entry, nullptr);
+                        }
+                        else
+                        {
+                            ASSERT_NE(entry, nullptr);
+                            EXPECT_EQ(entry->first, keys[index]);
+                            EXPECT_EQ(entry->second, index);
+                        }
+                    });
+    EXPECT_EQ(std::count(seen.begin(), seen.end(), true), static_cast<long>(keys.size()));
+
+    const uuids::uuid_map<std::size_t> empty;
+    std::size_t misses = 0;
+    empty.lookup_many(std::span<const uuids::uuid>(keys),
+                      [&](std::size_t, const auto* entry) { misses += entry == nullptr; });
+    EXPECT_EQ(misses, keys.size());
+}
+
+TEST(UuidSet, InsertAndLookupMany)
+{
+    uuids::uuid_generator gen;
+    uuids::uuid_set<> set;
+    const auto a = gen();
+    const auto b = gen();
+    EXPECT_TRUE(set.insert(a).second);
+    EXPECT_FALSE(set.insert(a).second);
+
+    const std::vector<uuids::uuid> keys{a, b};
+    std::vector<const uuids::uuid*> found(keys.size());
+    set.lookup_many(std::span<const uuids::uuid>(keys),
+                    [&](std::size_t index, const uuids::uuid* key) { found[index] = key; });
+    ASSERT_NE(found[0], nullptr);
+    EXPECT_EQ(*found[0], a);
+    EXPECT_EQ(found[1], nullptr);
+}
+
+TEST(UuidMap, HeterogeneousLookup)
+{
+    uuids::uuid_generator gen;
+    const auto id = gen();
+    uuids::uuid_map<int> map;
+    map.try_emplace(id, 7);
+
+    const std::string text = id.str();
+    EXPECT_EQ(map.find(std::string_view(text))->second, 7);
+    EXPECT_TRUE(map.contains(text));
+    EXPECT_FALSE(map.contains(gen().str()));
+    EXPECT_FALSE(map.contains("not a uuid"));
+
+    std::array<std::byte, 16> wire{};
+    std::memcpy(wire.data(), id.bytes().data(), wire.size());
+    EXPECT_EQ(map.count(std::span<const std::byte, 16>(wire)), 1u);
+
+    std::unordered_set<uuids::uuid, std::hash<uuids::uuid>, uuids::uuid_equal> std_set{id};
+    EXPECT_NE(std_set.find(std::string_view(text)), std_set.end());
+    EXPECT_NE(std_set.find(std::span<const std::byte, 16>(wire)), std_set.end());
+}
@@ -1,8 +1,157 @@
 #include <uuids/uuidv4.hpp>
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <random>
+#include <type_traits>
+#include <vector>
+
 TEST(UUIDV4, GenerateUUID) {
     // uuids::uuid uuid = uuids::uuid_v4::generate();
     // EXPECT_EQ(uuid.version(), 4); // Check if the version is 4
     // EXPECT_EQ(uuid.variant(), 2); // Check if the variant is RFC 4122
 }
+
+TEST(UUIDV4, ParseRoundTrip)
+{
+    const auto id = uuids::uuid_generator{}();
+    EXPECT_EQ(uuids::uuid::parse(id.str()), id);
+
+    const auto canonical = uuids::uuid::parse("017F22E2-79B0-7CC3-98C4-DC0C0C07398F");
+    ASSERT_TRUE(canonical.has_value());
+    EXPECT_EQ(canonical->str(), "017f22e2-79b0-7cc3-98c4-dc0c0c07398f");
+    EXPECT_EQ(uuids::uuid::parse("017f22e279b07cc398c4dc0c0c07398f"), canonical);
+}
+
+TEST(UUIDV4, ParseRejectsMalformedText)
+{
+    EXPECT_FALSE(uuids::uuid::parse(""));
+    EXPECT_FALSE(uuids::uuid::parse("017f22e2-79b0-7cc3-98c4-dc0c0c07398"));
+    EXPECT_FALSE(uuids::uuid::parse("017f22e2_79b0-7cc3-98c4-dc0c0c07398f"));
+    EXPECT_FALSE(uuids::uuid::parse("017f22e2-79b0-7cc3-98c4-dc0c0c07398g"));
+    EXPECT_FALSE(uuids::uuid::parse("017f22e2-79b0-7cc3-98c4-dc0c0c0739:f"));
+    EXPECT_FALSE(uuids::uuid::parse("017f22e2-79b0-7cc3-98c4-dc0c0c0739\xff" "f"));
+}
+
+TEST(UUIDV4, HashIsTransparent)
+{
+    const auto id = uuids::uuid_generator{}();
+    const std::hash<uuids::uuid> hash;
+    EXPECT_EQ(hash(id.str()), hash(id));
+
+    std::array<std::byte, 16> wire{};
+    std::memcpy(wire.data(), id.bytes().data(), wire.size());
+    EXPECT_EQ(hash(std::span<const std::byte, 16>(wire)), hash(id));
+    EXPECT_TRUE(uuids::uuid_equal{}(id, std::span<const std::byte, 16>(wire)));
+    EXPECT_TRUE(uuids::uuid_equal{}(id.str(), id));
+    EXPECT_FALSE(uuids::uuid_equal{}(id, "not a uuid"));
+}
+
+TEST(UUIDV4, GeneratorsShareOneValueType)
+{
+    static_assert(std::is_same_v<uuids::basic_uuid<std::minstd_rand>, uuids::uuid>);
+    static_assert(std::is_same_v<uuids::basic_uuid_generator<std::mt19937>::uuid_type,
+                                 uuids::uuid>);
+
+    uuids::basic_uuid_generator<std::mt19937> narrow(1);
+    uuids::uuid_generator wide(1);
+    const std::vector<uuids::uuid> ids{narrow(), wide()};
+    EXPECT_NE(ids[0], ids[1]);
+    EXPECT_EQ(ids[0].version(), 4);
+    EXPECT_EQ(ids[1].version(), 4);
+}
+
+TEST(UUIDV4, SecureGeneratorProducesVersion4)
+{
+    static_assert(uuids::detail::RandomNumberEngine<uuids::os_entropy_engine>);
+
+    uuids::secure_uuid_generator gen;
+    const auto a = gen();
+    const auto b = gen();
+    EXPECT_NE(a, b);
+    EXPECT_EQ(a.version(), 4);
+    EXPECT_EQ(a.variant(), 2);
+}
+
+TEST(UUIDV4, StrFromMemoryResource)
+{
+    std::array<std::byte, 256> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+
+    const auto id = uuids::uuid::parse("017f22e2-79b0-7cc3-98c4-dc0c0c07398f").value();
+    const std::pmr::string text = id.str(&arena);
+    EXPECT_EQ(std::string_view(text), id.str());
+    EXPECT_EQ(text.get_allocator().resource(), &arena);
+
+    const auto copy = id.str(std::pmr::polymorphic_allocator<char>(&arena));
+    static_assert(std::is_same_v<decltype(copy), const std::pmr::string>);
+    EXPECT_EQ(copy, text);
+}
+
+TEST(UUIDV4, HealthTestPassesRandomWords)
+{
+    using health_test = uuids::detail::entropy_health_test;
+    health_test health;
+    std::mt19937_64 rng(11);
+    std::array<std::uint64_t, health_test::block_words> block;
+    for (int i = 0; i < 4096; ++i)
+    {
+        for (auto& word : block)
+        {
+            word = rng();
+        }
+        ASSERT_EQ(health.test(block), health_test::verdict::pass);
+    }
+
+    // A single repeat is within the cutoff.
+    block[4] = block[3];
+    EXPECT_EQ(health.test(block), health_test::verdict::pass);
+}
+
+TEST(UUIDV4, HealthTestCatchesStuckWords)
+{
+    using health_test = uuids::detail::entropy_health_test;
+    std::array<std::uint64_t, health_test::block_words> block;
+
+    health_test ones;
+    block.fill(~std::uint64_t{0});
+    EXPECT_EQ(ones.test(block), health_test::verdict::repetition);
+
+    // The run straddles two blocks.
+    health_test straddled;
+    std::mt19937_64 rng(12);
+    for (auto& word : block)
+    {
+        word = rng();
+    }
+    block[health_test::block_words - 2] = block[health_test::block_words - 1] = 9;
+    EXPECT_EQ(straddled.test(block), health_test::verdict::pass);
+    block[0] = 9;
+    EXPECT_EQ(straddled.test(block), health_test::verdict::repetition);
+
+    // Alternating words never repeat back to back, but the window's first word recurs.
+    health_test alternating;
+    for (std::size_t i = 0; i < block.size(); ++i)
+    {
+        block[i] = i % 2 == 0 ? 0xAAAA : 0x5555;
+    }
+    EXPECT_EQ(alternating.test(block), health_test::verdict::proportion);
+}
+
+TEST(UUIDV4, HardwareEntropyStatusIsHealthy)
+{
+    uuids::uuid_generator gen;
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(gen().version(), 4);
+    }
+
+    const auto stats = uuids::hardware_entropy_status();
+    EXPECT_FALSE(stats.disabled);
+    EXPECT_EQ(stats.repetition_failures, 0u);
+    EXPECT_EQ(stats.proportion_failures, 0u);
+}
@@ -0,0 +1,131 @@
+#include <uuids/uuidv7.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+
+struct frozen_clock final
+{
+    [[nodiscard]] static std::uint64_t unix_ms() noexcept { return 1'700'000'000'000; }
+};
+
+} // namespace
+
+TEST(UUIDV7, LayoutRoundTrip)
+{
+    uuids::detail::uuid_bytes bytes;
+    bytes.data.fill(0xFF);
+
+    const auto tick = uuids::detail::v7_layout::tick(0x0123456789ABULL, 0xBEEF);
+    uuids::detail::v7_layout::encode(bytes, tick);
+
+    const uuids::uuid id(bytes);
+    EXPECT_EQ(id.version(), 7);
+    EXPECT_EQ(id.variant(), 2);
+    EXPECT_EQ(id.str().substr(0, 13), "01234567-89ab");
+    EXPECT_EQ(uuids::detail::v7_layout::decode_tick(bytes), tick);
+}
+
+TEST(UUIDV7, SharedGeneratorIsStrictlyIncreasing)
+{
+    uuids::shared_uuid_v7_generator gen;
+
+    auto previous = gen();
+    for (int i = 0; i < 100000; ++i)
+    {
+        const auto next = gen();
+        ASSERT_LT(previous, next);
+        ASSERT_EQ(next.version(), 7);
+        previous = next;
+    }
+}
+
+TEST(UUIDV7, SharedGeneratorBlocksAreContiguous)
+{
+    uuids::shared_uuid_v7_generator gen;
+    std::vector<uuids::uuid> block(1000);
+    gen.generate(block);
+
+    EXPECT_TRUE(std::is_sorted(block.begin(), block.end()));
+    const uuids::detail::uuid_bytes last{block.back().bytes()};
+    EXPECT_EQ(uuids::detail::v7_layout::decode_tick(last), gen.last_tick());
+}
+
+TEST(UUIDV7, SharedGeneratorTotalOrderAcrossThreads)
+{
+    constexpr std::size_t threads = 4;
+    constexpr std::size_t per_thread = 20000;
+
+    auto& gen = uuids::shared_uuid_v7_generator::global();
+    std::vector<std::vector<uuids::uuid>> results(threads);
+
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back(
+            [&gen, &out = results[t]]()
+            {
+                out.reserve(per_thread);
+                for (std::size_t i = 0; i < per_thread; ++i)
+                {
+                    out.push_back(gen());
+                }
+            });
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::vector<std::uint64_t> ticks;
+    for (const auto& out : results)
+    {
+        EXPECT_TRUE(std::is_sorted(out.begin(), out.end()));
+        for (const auto& id : out)
+        {
+            ticks.push_back(
+                uuids::detail::v7_layout::decode_tick(uuids::detail::uuid_bytes{id.bytes()}));
+        }
+    }
+
+    std::sort(ticks.begin(), ticks.end());
+    EXPECT_EQ(std::adjacent_find(ticks.begin(), ticks.end()), ticks.end());
+}
+
+TEST(UUIDV7, ChildAfterForkDrawsFreshRandomBits)
+{
+    // With the clock frozen, parent and child reserve the same tick from their copies of the
+    // generator, so only the random bits can tell their IDs apart.
+    uuids::basic_shared_uuid_v7_generator<std::mt19937_64, frozen_clock> gen;
+    static_cast<void>(gen());
+
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        const auto id = gen();
+        const bool written = ::write(fds[1], &id, sizeof(id)) == sizeof(id);
+        ::_exit(written ? 0 : 1);
+    }
+
+    const auto parent_id = gen();
+    uuids::uuid child_id;
+    ASSERT_EQ(::read(fds[0], &child_id, sizeof(child_id)), static_cast<ssize_t>(sizeof(child_id)));
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    ::close(fds[0]);
+    ::close(fds[1]);
+    EXPECT_EQ(uuids::detail::v7_layout::decode_tick(uuids::detail::uuid_bytes(child_id.bytes())),
+              uuids::detail::v7_layout::decode_tick(uuids::detail::uuid_bytes(parent_id.bytes())));
+    EXPECT_NE(child_id, parent_id);
+}
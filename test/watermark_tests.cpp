@@ -0,0 +1,109 @@
+#include <uuids/watermark.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+
+std::string temp_path(const char* tag)
+{
+    return "/tmp/uuids-" + std::string(tag) + "-" + std::to_string(::getpid()) + ".wm";
+}
+
+std::uint64_t tick_of(const uuids::uuid& id)
+{
+    return uuids::detail::v7_layout::decode_tick(uuids::detail::uuid_bytes{id.bytes()});
+}
+
+} // namespace
+
+TEST(Watermark, OneSyncPerWindow)
+{
+    const auto path = temp_path("window");
+    std::remove(path.c_str());
+
+    uuids::persistent_uuid_v7_generator gen(path);
+    std::vector<uuids::uuid> ids(10000);
+    gen.generate(ids);
+    for (int i = 0; i < 10000; ++i)
+    {
+        static_cast<void>(gen());
+    }
+
+    EXPECT_EQ(gen.sync_count(), 1u);
+    EXPECT_LT(tick_of(ids.back()), gen.durable_limit());
+    std::remove(path.c_str());
+}
+
+TEST(Watermark, RestartResumesAboveReservedBoundary)
+{
+    const auto path = temp_path("restart");
+    std::remove(path.c_str());
+
+    std::uint64_t boundary = 0;
+    uuids::uuid last;
+    {
+        uuids::persistent_uuid_v7_generator gen(path);
+        last = gen();
+        boundary = gen.durable_limit();
+    }
+
+    uuids::persistent_uuid_v7_generator restarted(path);
+    const auto first = restarted();
+    EXPECT_LT(last, first);
+    EXPECT_GE(tick_of(first), boundary);
+    std::remove(path.c_str());
+}
+
+TEST(Watermark, ClockBehindBoundaryDoesNotRegress)
+{
+    const auto path = temp_path("regress");
+    std::remove(path.c_str());
+
+    const auto future_ms = uuids::detail::system_unix_ms() + 3'600'000;
+    const auto future = uuids::detail::v7_layout::tick(future_ms);
+    {
+        uuids::v7_watermark_file file(path);
+        file.persist(future);
+    }
+
+    uuids::persistent_uuid_v7_generator gen(path);
+    EXPECT_GE(tick_of(gen()), future);
+    std::remove(path.c_str());
+}
+
+TEST(Watermark, CorruptFileIsRejected)
+{
+    const auto path = temp_path("corrupt");
+    std::remove(path.c_str());
+
+    {
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        const char garbage[32] = "not a watermark record";
+        std::fwrite(garbage, 1, sizeof(garbage), file);
+        std::fclose(file);
+    }
+
+    EXPECT_THROW(uuids::v7_watermark_file{path}, std::system_error);
+    std::remove(path.c_str());
+}
+
+TEST(Watermark, SecondOwnerIsRejected)
+{
+    const auto path = temp_path("locked");
+    std::remove(path.c_str());
+
+    {
+        uuids::persistent_uuid_v7_generator owner(path);
+        static_cast<void>(owner());
+        EXPECT_THROW(uuids::persistent_uuid_v7_generator{path}, std::system_error);
+    }
+
+    // The lock goes with the owner.
+    uuids::persistent_uuid_v7_generator next(path);
+    EXPECT_GT(next.durable_limit(), 0u);
+    std::remove(path.c_str());
+}